@@ -10,6 +10,9 @@
  */
 
 #include "Appetizer.hpp"
+#include "DishInstrumentation.hpp"
+#include "MenuRenderer.hpp"
+#include <utility> // For std::move
 
 /**
 * Default constructor with inheritence from Dish default constructor.
@@ -18,16 +21,13 @@
 * - spiciness_level_: 0
 * - vegetarian_: False
 */
-Appetizer::Appetizer() : Dish()
+Appetizer::Appetizer() : Appetizer(allocator_type())
 {
-    this->serving_style_ = Appetizer::PLATED;
-    this->spiciness_level_ = 0;
-    this->vegetarian_ = false;
 }
 
 /**
 * Parameterized constructor with inheritance from Dish parameterized constructor.
-* @param name A reference to the name of the dish.
+* @param name The name of the dish, copied into the dish's memory resource.
 * @param ingredients A reference to a list of ingredients (default is
 empty list).
 * @param prep_time The preparation time in minutes (default is 0).
@@ -37,26 +37,108 @@ with default value OTHER.
 * @param serving_style The serving style of the appetizer (a ServingStyle enum)
 * @param spiciness_level The spiciness level
 * @param vegetarian A reference to whether the appetizer is vegetarian
-Accessors and Mutators:
+* @param alloc The allocator the dish takes its memory from (default is
+the default memory resource).
 * @post The private members are set to the values of the corresponding
 parameters.
 */
-Appetizer::Appetizer(const std::string& name, const std::vector<std::string>& ingredients, const int& prep_time, const double& price, const CuisineType cuisine_type, const ServingStyle serving_style, const int& spiciness_level, const bool& vegetarian) : Dish(name, ingredients, prep_time, price, cuisine_type)
+Appetizer::Appetizer(std::string_view name, const std::vector<std::string>& ingredients, const int& prep_time, const double& price, const CuisineType cuisine_type, const ServingStyle serving_style, const int& spiciness_level, const bool& vegetarian, const allocator_type& alloc) : Dish(name, ingredients, prep_time, price, cuisine_type, alloc)
 {
-    this->serving_style_ = serving_style;
+    setCourse(Course::APPETIZER);
+    setStyle(serving_style);
     this->spiciness_level_ = spiciness_level;
-    this->vegetarian_ = vegetarian;
+    setFlag(kVegetarianFlag, vegetarian);
+    DISH_COUNT(APPETIZER, CONSTRUCTIONS);
+}
+
+/**
+* Default constructor with a memory resource.
+* @param alloc The allocator the appetizer takes its memory from.
+* @post The private members are set to the same values as the default
+constructor.
+*/
+Appetizer::Appetizer(const allocator_type& alloc) : Dish(alloc), spiciness_level_(0)
+{
+    setCourse(Course::APPETIZER);
+    setStyle(Appetizer::PLATED);
+    DISH_COUNT(APPETIZER, CONSTRUCTIONS);
+}
+
+/**
+* Copy constructor.
+* @param other A reference to the appetizer to copy.
+* @param alloc The allocator the copy takes its memory from (default is
+the default memory resource).
+*/
+Appetizer::Appetizer(const Appetizer& other, const allocator_type& alloc) : Dish(other, alloc), spiciness_level_(other.spiciness_level_)
+{
+    assignAttributes(other);
+    DISH_COUNT(APPETIZER, COPIES);
+}
+
+/**
+* Move constructor, the new appetizer keeps the memory resource of `other`.
+* @param other The appetizer to move from.
+*/
+Appetizer::Appetizer(Appetizer&& other) noexcept : Dish(std::move(other)), spiciness_level_(other.spiciness_level_)
+{
+    assignAttributes(other);
+    DISH_COUNT(APPETIZER, MOVES);
+}
+
+/**
+* Move constructor with a memory resource.
+* @param other The appetizer to move from.
+* @param alloc The allocator of the new appetizer, the members are copied
+if it differs from the one of `other`.
+*/
+Appetizer::Appetizer(Appetizer&& other, const allocator_type& alloc) : Dish(std::move(other), alloc), spiciness_level_(other.spiciness_level_)
+{
+    assignAttributes(other);
+    DISH_COUNT(APPETIZER, MOVES);
+}
+
+/**
+* Copy assignment operator.
+* @param other A reference to the appetizer to copy.
+* @return A reference to this appetizer.
+*/
+Appetizer& Appetizer::operator=(const Appetizer& other)
+{
+    Change change(*this, DishObserver::Field::ALL);
+    assignDish(other);
+    assignAttributes(other);
+    spiciness_level_ = other.spiciness_level_;
+    DISH_COUNT(APPETIZER, COPIES);
+    return *this;
+}
+
+/**
+* Move assignment operator.
+* @param other The appetizer to move from.
+* @return A reference to this appetizer.
+*/
+Appetizer& Appetizer::operator=(Appetizer&& other)
+{
+    Change change(*this, DishObserver::Field::ALL);
+    Change source_change(other, DishObserver::Field::ALL);
+    assignDish(std::move(other));
+    assignAttributes(other);
+    spiciness_level_ = other.spiciness_level_;
+    DISH_COUNT(APPETIZER, MOVES);
+    return *this;
 }
 
 /**
  * Sets the serving style of the appetizer.
  * @param serving_style The new serving style.
- * @post Sets the private member `serving_style_` to the value of the
+ * @post Sets the style bits of the attribute word to the value of the
 parameter.
  */
 void Appetizer::setServingStyle(const ServingStyle& serving_style)
 {
-    this->serving_style_ = serving_style;
+    Change change(*this, DishObserver::Field::SERVING_STYLE);
+    setStyle(serving_style);
 }
 
 /**
@@ -64,7 +146,7 @@ void Appetizer::setServingStyle(const ServingStyle& serving_style)
  */
 Appetizer::ServingStyle Appetizer::getServingStyle() const
 {
-    return serving_style_;
+    return static_cast<ServingStyle>(getStyle());
 }
 
 /**
@@ -76,6 +158,7 @@ parameter.
  */
 void Appetizer::setSpicinessLevel(const int& spiciness_level)
 {
+    Change change(*this, DishObserver::Field::SPICINESS_LEVEL);
     this->spiciness_level_ = spiciness_level;
 }
 
@@ -91,12 +174,13 @@ int Appetizer::getSpicinessLevel() const
  * Sets the vegetarian flag of the appetizer.
  * @param vegetarian A boolean indicating if the appetizer is
 vegetarian.
- * @post Sets the private member `vegetarian_` to the value of the
+ * @post Sets the vegetarian flag of the attribute word to the value of the
 parameter.
  */
 void Appetizer::setVegetarian(const bool& vegetarian)
 {
-    this->vegetarian_ = vegetarian;
+    Change change(*this, DishObserver::Field::VEGETARIAN);
+    setFlag(kVegetarianFlag, vegetarian);
 }
 
 /**
@@ -104,7 +188,7 @@ void Appetizer::setVegetarian(const bool& vegetarian)
 */
 bool Appetizer::isVegetarian() const
 {
-    return vegetarian_;
+    return getFlag(kVegetarianFlag);
 }
 
 // Helper function to display outputs
@@ -113,30 +197,10 @@ bool Appetizer::isVegetarian() const
  */
 void Appetizer::displayAppetizer() const
 {
-    std::cout << "Spiciness Level: " << getSpicinessLevel() << std::endl;
-    std::cout << "Serving Style: ";
-    if (serving_style_== 0)
-    {
-        std::cout << "PLATED" << std::endl;
-    }
-    if (serving_style_ == 1)
-    {
-        std::cout << "FAMILY_SIZE" << std::endl;
-    }
-    if (serving_style_ == 2)
-    {
-        std::cout << "BUFFET" << std::endl;
-    }
-    
-    std::cout << "Vegetarian: ";
-    if (isVegetarian() == 1)
-    {
-        std::cout << "True" << std::endl;
-    }
-    else
-    {
-        std::cout << "False" << std::endl;
-    }
+    OStreamSink sink(std::cout);
+    MenuRenderer renderer(sink);
+    renderer.renderAppetizer(*this);
+    renderer.flush();
 }
 
 
@@ -16,6 +16,7 @@
 #include "Dish.hpp"
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <iomanip> // For std::fixed and std::setprecision
 #include <cctype>  // For std::isalpha, std::isspace
@@ -38,7 +39,7 @@ public:
 
 /**
 * Parameterized constructor of Appetizer with inheritance from Dish parameterized constructor.
-* @param name A reference to the name of the dish.
+* @param name The name of the dish, copied into the dish's memory resource.
 * @param ingredients A reference to a list of ingredients (default is
 empty list).
 * @param prep_time The preparation time in minutes (default is 0).
@@ -48,16 +49,53 @@ with default value OTHER.
 * @param serving_style The serving style of the appetizer (a ServingStyle enum)
 * @param spiciness_level The spiciness level
 * @param vegetarian A reference to whether the appetizer is vegetarian
-Accessors and Mutators:
+* @param alloc The allocator the dish takes its memory from (default is
+the default memory resource).
 * @post The private members are set to the values of the corresponding
 parameters.
 */
-    Appetizer(const std::string& name, const std::vector<std::string>& ingredients, const int& prep_time, const double& price, const CuisineType cuisine_type, const ServingStyle serving_style, const int& spiciness_level, const bool& vegetarian);
+    Appetizer(std::string_view name, const std::vector<std::string>& ingredients, const int& prep_time, const double& price, const CuisineType cuisine_type, const ServingStyle serving_style, const int& spiciness_level, const bool& vegetarian, const allocator_type& alloc = {});
+
+/**
+* Default constructor with a memory resource.
+* @param alloc The allocator the appetizer takes its memory from.
+* @post The private members are set to the same values as the default
+constructor.
+*/
+    explicit Appetizer(const allocator_type& alloc);
+
+/**
+* Copy constructor.
+* @param other A reference to the appetizer to copy.
+* @param alloc The allocator the copy takes its memory from (default is
+the default memory resource).
+*/
+    Appetizer(const Appetizer& other, const allocator_type& alloc = {});
+
+/**
+* Move constructor, the new appetizer keeps the memory resource of `other`.
+*/
+    Appetizer(Appetizer&& other) noexcept;
+
+/**
+* Move constructor with a memory resource.
+* @param other The appetizer to move from.
+* @param alloc The allocator of the new appetizer, the members are copied
+if it differs from the one of `other`.
+*/
+    Appetizer(Appetizer&& other, const allocator_type& alloc);
+
+/**
+* Assignment operators. Each appetizer keeps its own observer, which sees the
+assignment as a change of ALL fields.
+*/
+    Appetizer& operator=(const Appetizer& other);
+    Appetizer& operator=(Appetizer&& other);
 
 /**
  * Sets the serving style of the appetizer.
  * @param serving_style The new serving style.
- * @post Sets the private member `serving_style_` to the value of the
+ * @post Sets the style bits of the attribute word to the value of the
 parameter.
  */
     void setServingStyle(const ServingStyle& serving_style);
@@ -85,7 +123,7 @@ parameter.
  * Sets the vegetarian flag of the appetizer.
  * @param vegetarian A boolean indicating if the appetizer is
 vegetarian.
- * @post Sets the private member `vegetarian_` to the value of the
+ * @post Sets the vegetarian flag of the attribute word to the value of the
 parameter.
  */
     void setVegetarian(const bool& vegetarian);
@@ -102,9 +140,7 @@ parameter.
     void displayAppetizer() const;
 
 private:
-    ServingStyle serving_style_;
-    int spiciness_level_;
-    bool vegetarian_;
+    int spiciness_level_;  // the serving style and vegetarian flag live in the attribute word
 };
 
 #endif // APPETIZER_HPP
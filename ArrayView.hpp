@@ -0,0 +1,100 @@
+/**
+ * @file ArrayView.hpp
+ * @brief This file contains the ArrayView class template, a read-only view over a contiguous array.
+ *
+ * ArrayView plays the role of std::span (which is not available in C++17) for the zero-copy accessors of
+ * the Dish hierarchy. A view only stores a pointer and a size, it never owns or copies the elements.
+ * A view returned by an accessor is valid until the object it came from is modified, moved or destroyed.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef ARRAY_VIEW_HPP
+#define ARRAY_VIEW_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+template <typename T>
+class ArrayView {
+public:
+    using value_type = T;
+    using const_iterator = const T*;
+
+    /**
+     * Default constructor.
+     * Creates an empty view.
+     */
+    ArrayView() : data_(nullptr), size_(0) {
+    }
+
+    /**
+     * Parameterized constructor.
+     * @param data A pointer to the first element.
+     * @param size The number of elements.
+     */
+    ArrayView(const T* data, std::size_t size) : data_(data), size_(size) {
+    }
+
+    /**
+     * Creates a view over a container with contiguous storage (std::vector, std::array, ...).
+     * @param container A reference to the container, which must outlive the view.
+     */
+    template <typename Container,
+              typename = std::enable_if_t<std::is_convertible_v<decltype(std::declval<const Container&>().data()), const T*>>>
+    ArrayView(const Container& container) : data_(container.data()), size_(container.size()) {
+    }
+
+    /**
+     * Creates a view over a built-in array.
+     * @param array A reference to the array, which must outlive the view.
+     */
+    template <std::size_t N>
+    ArrayView(const T (&array)[N]) : data_(array), size_(N) {
+    }
+
+    /**
+     * @return A pointer to the first element.
+     */
+    const T* data() const {
+        return data_;
+    }
+
+    /**
+     * @return The number of elements.
+     */
+    std::size_t size() const {
+        return size_;
+    }
+
+    /**
+     * @return True if the view has no elements, false otherwise.
+     */
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    /**
+     * @param i The position of the element, must be less than size().
+     * @return A reference to the element at position i.
+     */
+    const T& operator[](std::size_t i) const {
+        return data_[i];
+    }
+
+    const_iterator begin() const {
+        return data_;
+    }
+
+    const_iterator end() const {
+        return data_ + size_;
+    }
+
+private:
+    const T* data_;
+    std::size_t size_;
+};
+
+#endif // ARRAY_VIEW_HPP
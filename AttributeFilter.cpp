@@ -0,0 +1,75 @@
+/**
+ * @file AttributeFilter.cpp
+ * @brief This file contains the implementation of the AttributeFilter class.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "AttributeFilter.hpp"
+
+// Constructor
+AttributeFilter::AttributeFilter() : mask_(0), value_(0) {
+}
+
+// Conditions
+AttributeFilter& AttributeFilter::course(Dish::Course course) {
+    require(Dish::kCourseMask, static_cast<std::uint32_t>(course) << Dish::kCourseShift);
+    return *this;
+}
+
+AttributeFilter& AttributeFilter::cuisineType(Dish::CuisineType cuisine_type) {
+    require(Dish::kCuisineTypeMask, static_cast<std::uint32_t>(cuisine_type) << Dish::kCuisineTypeShift);
+    return *this;
+}
+
+AttributeFilter& AttributeFilter::servingStyle(Appetizer::ServingStyle serving_style) {
+    require(Dish::kStyleMask, static_cast<std::uint32_t>(serving_style) << Dish::kStyleShift);
+    return course(Dish::Course::APPETIZER);
+}
+
+AttributeFilter& AttributeFilter::cookingMethod(MainCourse::CookingMethod cooking_method) {
+    require(Dish::kStyleMask, static_cast<std::uint32_t>(cooking_method) << Dish::kStyleShift);
+    return course(Dish::Course::MAIN_COURSE);
+}
+
+AttributeFilter& AttributeFilter::flavorProfile(Dessert::FlavorProfile flavor_profile) {
+    require(Dish::kStyleMask, static_cast<std::uint32_t>(flavor_profile) << Dish::kStyleShift);
+    return course(Dish::Course::DESSERT);
+}
+
+AttributeFilter& AttributeFilter::vegetarian(bool vegetarian) {
+    require(Dish::kVegetarianFlag, vegetarian ? Dish::kVegetarianFlag : 0);
+    return course(Dish::Course::APPETIZER);
+}
+
+AttributeFilter& AttributeFilter::glutenFree(bool gluten_free) {
+    require(Dish::kGlutenFreeFlag, gluten_free ? Dish::kGlutenFreeFlag : 0);
+    return course(Dish::Course::MAIN_COURSE);
+}
+
+AttributeFilter& AttributeFilter::containsNuts(bool contains_nuts) {
+    require(Dish::kContainsNutsFlag, contains_nuts ? Dish::kContainsNutsFlag : 0);
+    return course(Dish::Course::DESSERT);
+}
+
+AttributeFilter& AttributeFilter::sideDishCategory(MainCourse::Category category, bool served) {
+    std::uint32_t bit = MainCourse::sideDishCategoryBit(category) << Dish::kSideDishCategoryShift;
+    require(bit, served ? bit : 0);
+    return course(Dish::Course::MAIN_COURSE);
+}
+
+// Accessors
+std::uint32_t AttributeFilter::mask() const {
+    return mask_;
+}
+
+std::uint32_t AttributeFilter::value() const {
+    return value_;
+}
+
+// Helper function to set the bits of one condition
+void AttributeFilter::require(std::uint32_t mask, std::uint32_t value) {
+    mask_ |= mask;
+    value_ = (value_ & ~mask) | (value & mask);
+}
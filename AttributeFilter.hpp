@@ -0,0 +1,79 @@
+/**
+ * @file AttributeFilter.hpp
+ * @brief This file contains the declaration of the AttributeFilter class, a predicate over the attribute word of a dish.
+ *
+ * A filter is a mask and a value over Dish::getAttributes(): a dish passes if (attributes & mask) == value.
+ * Every condition the filter is built from sets some bits of both, so a combination such as "vegetarian
+ * Italian appetizer" is tested with one AND and one compare, whatever the class of the dish. The same
+ * test runs over the attribute column of a DishCatalog (see DishFilter::attributesMatch()).
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef ATTRIBUTE_FILTER_HPP
+#define ATTRIBUTE_FILTER_HPP
+
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include <cstdint>
+
+class AttributeFilter {
+public:
+    /**
+     * Default constructor.
+     * Creates a filter every dish passes.
+     */
+    AttributeFilter();
+
+    // Conditions, each returns the filter so they can be chained. A later condition on the same bits
+    // replaces the earlier one. The style and flag conditions also require the course they belong to.
+    // Side dish conditions on different categories add up: every one of them must hold. For "any of
+    // several categories" see DishFilter::sideDishCategoryAny().
+    AttributeFilter& course(Dish::Course course);
+    AttributeFilter& cuisineType(Dish::CuisineType cuisine_type);
+    AttributeFilter& servingStyle(Appetizer::ServingStyle serving_style);
+    AttributeFilter& cookingMethod(MainCourse::CookingMethod cooking_method);
+    AttributeFilter& flavorProfile(Dessert::FlavorProfile flavor_profile);
+    AttributeFilter& vegetarian(bool vegetarian);
+    AttributeFilter& glutenFree(bool gluten_free);
+    AttributeFilter& containsNuts(bool contains_nuts);
+    AttributeFilter& sideDishCategory(MainCourse::Category category, bool served);
+
+    /**
+     * @return The bits of the attribute word the filter looks at.
+     */
+    std::uint32_t mask() const;
+
+    /**
+     * @return The value those bits must have.
+     */
+    std::uint32_t value() const;
+
+    /**
+     * @param attributes An attribute word (see Dish::getAttributes()).
+     * @return True if the word passes the filter, false otherwise.
+     */
+    bool matches(std::uint32_t attributes) const {
+        return (attributes & mask_) == value_;
+    }
+
+    /**
+     * @param dish A reference to a dish of any class.
+     * @return True if the dish passes the filter, false otherwise.
+     */
+    bool matches(const Dish& dish) const {
+        return matches(dish.getAttributes());
+    }
+
+private:
+    // Requires the bits under `mask` to equal `value`
+    void require(std::uint32_t mask, std::uint32_t value);
+
+    std::uint32_t mask_;
+    std::uint32_t value_;
+};
+
+#endif // ATTRIBUTE_FILTER_HPP
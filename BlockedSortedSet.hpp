@@ -0,0 +1,207 @@
+/**
+ * @file BlockedSortedSet.hpp
+ * @brief This file contains the BlockedSortedSet class template, an ordered set of (key, id) entries kept in sorted blocks.
+ *
+ * The entries are split into blocks of at most kMaxBlockSize sorted entries, and the blocks are ordered
+ * too, which makes the set a two-level B+-tree: a binary search over the last entry of every block finds
+ * the leaf, a binary search inside the block finds the entry. An insert or erase moves at most one block
+ * of entries, a full block is split in two, and an empty block is dropped. Range scans walk the blocks in
+ * order through a Cursor, so a scan that stops early only touches the blocks it read.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef BLOCKED_SORTED_SET_HPP
+#define BLOCKED_SORTED_SET_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+template <typename Key>
+class BlockedSortedSet {
+public:
+    // Entry definition, ordered by key and then by id so equal keys stay distinct
+    struct Entry {
+        Key key;
+        std::uint32_t id;
+
+        bool operator<(const Entry& other) const {
+            return key < other.key || (!(other.key < key) && id < other.id);
+        }
+
+        bool operator==(const Entry& other) const {
+            return !(key < other.key) && !(other.key < key) && id == other.id;
+        }
+    };
+
+    /**
+     * A position in the set, walks the entries in increasing order.
+     * A Cursor stays valid until the set is modified.
+     */
+    class Cursor {
+    public:
+        Cursor(const BlockedSortedSet& set, std::size_t block, std::size_t position)
+            : set_(&set), block_(block), position_(position) {
+        }
+
+        /**
+         * @return True if the cursor is at an entry, false if it is past the last one.
+         */
+        bool valid() const {
+            return block_ < set_->blocks_.size();
+        }
+
+        /**
+         * @return The entry at the cursor, the cursor must be valid.
+         */
+        const Entry& operator*() const {
+            return set_->blocks_[block_][position_];
+        }
+
+        /**
+         * Moves to the next entry.
+         */
+        void next() {
+            if (++position_ == set_->blocks_[block_].size()) {
+                ++block_;
+                position_ = 0;
+            }
+        }
+
+    private:
+        const BlockedSortedSet* set_;
+        std::size_t block_;
+        std::size_t position_;
+    };
+
+    /**
+     * Default constructor.
+     * Creates an empty set.
+     */
+    BlockedSortedSet() : size_(0) {
+    }
+
+    /**
+     * Inserts an entry, which must not already be in the set.
+     */
+    void insert(Key key, std::uint32_t id);
+
+    /**
+     * Erases an entry.
+     * @return True if the entry was in the set, false otherwise.
+     */
+    bool erase(Key key, std::uint32_t id);
+
+    /**
+     * @return A cursor at the first entry with a key not less than `key`.
+     */
+    Cursor lowerBound(Key key) const;
+
+    /**
+     * @return A cursor at the first entry.
+     */
+    Cursor begin() const {
+        return Cursor(*this, 0, 0);
+    }
+
+    /**
+     * @return The number of entries in the set.
+     */
+    std::size_t size() const {
+        return size_;
+    }
+
+    /**
+     * @return True if the set has no entries, false otherwise.
+     */
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    /**
+     * Removes every entry.
+     */
+    void clear() {
+        blocks_.clear();
+        lasts_.clear();
+        size_ = 0;
+    }
+
+private:
+    // A full block is split into two blocks of half this size
+    static const std::size_t kMaxBlockSize = 256;
+
+    // Returns the block that holds the entry or would hold it, blocks_.size() if it is past the last entry
+    std::size_t findBlock(const Entry& entry) const {
+        return static_cast<std::size_t>(std::lower_bound(lasts_.begin(), lasts_.end(), entry) - lasts_.begin());
+    }
+
+    std::vector<std::vector<Entry>> blocks_;  // sorted, never empty
+    std::vector<Entry> lasts_;                // the last entry of every block, searched to find a block
+    std::size_t size_;
+};
+
+// Template Functions
+template <typename Key>
+void BlockedSortedSet<Key>::insert(Key key, std::uint32_t id) {
+    Entry entry = {key, id};
+    if (blocks_.empty()) {
+        blocks_.emplace_back(1, entry);
+        lasts_.push_back(entry);
+        ++size_;
+        return;
+    }
+    std::size_t b = std::min(findBlock(entry), blocks_.size() - 1);
+    std::vector<Entry>& block = blocks_[b];
+    block.insert(std::lower_bound(block.begin(), block.end(), entry), entry);
+    lasts_[b] = block.back();
+    ++size_;
+
+    if (block.size() >= kMaxBlockSize) {
+        std::vector<Entry> upper(block.begin() + kMaxBlockSize / 2, block.end());
+        block.resize(kMaxBlockSize / 2);
+        lasts_[b] = block.back();
+        lasts_.insert(lasts_.begin() + static_cast<std::ptrdiff_t>(b + 1), upper.back());
+        blocks_.insert(blocks_.begin() + static_cast<std::ptrdiff_t>(b + 1), std::move(upper));
+    }
+}
+
+template <typename Key>
+bool BlockedSortedSet<Key>::erase(Key key, std::uint32_t id) {
+    Entry entry = {key, id};
+    std::size_t b = findBlock(entry);
+    if (b == blocks_.size()) {
+        return false;
+    }
+    std::vector<Entry>& block = blocks_[b];
+    auto position = std::lower_bound(block.begin(), block.end(), entry);
+    if (position == block.end() || !(*position == entry)) {
+        return false;
+    }
+    block.erase(position);
+    --size_;
+    if (block.empty()) {
+        blocks_.erase(blocks_.begin() + static_cast<std::ptrdiff_t>(b));
+        lasts_.erase(lasts_.begin() + static_cast<std::ptrdiff_t>(b));
+    } else {
+        lasts_[b] = block.back();
+    }
+    return true;
+}
+
+template <typename Key>
+typename BlockedSortedSet<Key>::Cursor BlockedSortedSet<Key>::lowerBound(Key key) const {
+    // The smallest entry with the key has the smallest id
+    Entry entry = {key, 0};
+    std::size_t b = findBlock(entry);
+    if (b == blocks_.size()) {
+        return Cursor(*this, b, 0);
+    }
+    const std::vector<Entry>& block = blocks_[b];
+    return Cursor(*this, b, static_cast<std::size_t>(std::lower_bound(block.begin(), block.end(), entry) - block.begin()));
+}
+
+#endif // BLOCKED_SORTED_SET_HPP
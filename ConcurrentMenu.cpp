@@ -0,0 +1,55 @@
+/**
+ * @file ConcurrentMenu.cpp
+ * @brief This file contains the implementation of the ConcurrentMenu class.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "ConcurrentMenu.hpp"
+
+// Constructors and Destructor
+ConcurrentMenu::ConcurrentMenu() : current_(new Version{Menu(), 0}) {
+}
+
+ConcurrentMenu::ConcurrentMenu(const Menu& menu) : current_(new Version{menu, 0}) {
+}
+
+ConcurrentMenu::~ConcurrentMenu() {
+    delete current_.load(std::memory_order_relaxed);
+}
+
+// Reading Functions
+ConcurrentMenu::Snapshot ConcurrentMenu::snapshot() const {
+    EpochDomain::Guard guard = EpochDomain::global().pin();
+    const Version* version = current_.load(std::memory_order_seq_cst);
+    return Snapshot(std::move(guard), version);
+}
+
+std::uint64_t ConcurrentMenu::version() const {
+    EpochDomain::Guard guard = EpochDomain::global().pin();
+    return current_.load(std::memory_order_seq_cst)->number;
+}
+
+// Update Functions
+ConcurrentMenu::Update ConcurrentMenu::update() {
+    return Update(*this);
+}
+
+ConcurrentMenu::Update::Update(ConcurrentMenu& owner) : owner_(owner), lock_(owner.update_mutex_) {
+    // Only updates replace the current version, and they are serialized, so it cannot be deleted here
+    const Version* current = owner_.current_.load(std::memory_order_acquire);
+    draft_.reset(new Version{current->menu, current->number + 1});
+}
+
+Menu& ConcurrentMenu::Update::menu() {
+    return draft_->menu;
+}
+
+std::uint64_t ConcurrentMenu::Update::commit() {
+    std::uint64_t number = draft_->number;
+    const Version* previous = owner_.current_.exchange(draft_.release(), std::memory_order_seq_cst);
+    EpochDomain::global().retire(const_cast<Version*>(previous));
+    lock_.unlock();
+    return number;
+}
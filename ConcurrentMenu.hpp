@@ -0,0 +1,142 @@
+/**
+ * @file ConcurrentMenu.hpp
+ * @brief This file contains the declaration of the ConcurrentMenu class, a menu many threads read while managers update it.
+ *
+ * The menu is kept as a chain of immutable versions. A reader takes a Snapshot, which pins an epoch (see
+ * EpochDomain) and loads the current version: no lock, no shared write, and the snapshot stays consistent
+ * however many updates are published while it is alive. A writer opens an Update, which copies the current
+ * version once, applies any number of changes to the copy through the usual Dish setters and commits them
+ * by swapping one pointer; the version it replaces is deleted when the last snapshot of it is gone. Updates
+ * are serialized by a mutex, so an update never loses another one's changes.
+ *
+ * Copying the menu is the price of an update, so writers should batch their changes into one update.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef CONCURRENT_MENU_HPP
+#define CONCURRENT_MENU_HPP
+
+#include "EpochDomain.hpp"
+#include "Menu.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+class ConcurrentMenu {
+    struct Version {
+        Menu menu;
+        std::uint64_t number;
+    };
+
+public:
+    /**
+     * A consistent, read-only view of one version of the menu.
+     * It must be destroyed on the thread that took it.
+     */
+    class Snapshot {
+    public:
+        /**
+         * @return The menu of this version.
+         */
+        const Menu& menu() const {
+            return version_->menu;
+        }
+
+        const Menu* operator->() const {
+            return &version_->menu;
+        }
+
+        /**
+         * @return The number of the version, 0 for the initial menu and one more for every committed update.
+         */
+        std::uint64_t version() const {
+            return version_->number;
+        }
+
+    private:
+        friend class ConcurrentMenu;
+
+        Snapshot(EpochDomain::Guard&& guard, const Version* version) : guard_(std::move(guard)), version_(version) {
+        }
+
+        EpochDomain::Guard guard_;
+        const Version* version_;
+    };
+
+    /**
+     * A batch of changes to the menu, made on a private copy and published by commit().
+     * Destroying an update without committing it discards the changes. Holds off other updates until then.
+     */
+    class Update {
+    public:
+        Update(const Update&) = delete;
+        Update& operator=(const Update&) = delete;
+
+        /**
+         * @return The copy of the menu to change, which no reader sees before commit().
+         */
+        Menu& menu();
+
+        /**
+         * Publishes the changed menu to new snapshots and lets the next update start. Call it at most once.
+         * @return The number of the new version.
+         */
+        std::uint64_t commit();
+
+    private:
+        friend class ConcurrentMenu;
+
+        explicit Update(ConcurrentMenu& owner);
+
+        ConcurrentMenu& owner_;
+        std::unique_lock<std::mutex> lock_;
+        std::unique_ptr<Version> draft_;
+    };
+
+    /**
+     * Default constructor.
+     * Creates an empty menu.
+     */
+    ConcurrentMenu();
+
+    /**
+     * Parameterized constructor.
+     * @param menu The initial menu, version 0. Observers of its dishes are not copied.
+     */
+    explicit ConcurrentMenu(const Menu& menu);
+
+    /**
+     * Destructor.
+     * No snapshot or update may be alive any more.
+     */
+    ~ConcurrentMenu();
+
+    ConcurrentMenu(const ConcurrentMenu&) = delete;
+    ConcurrentMenu& operator=(const ConcurrentMenu&) = delete;
+
+    /**
+     * Takes a snapshot of the current version. Never blocks.
+     * @return The snapshot.
+     */
+    Snapshot snapshot() const;
+
+    /**
+     * Starts a batch of changes, waiting for the update of another thread to finish first.
+     * @return The update.
+     */
+    Update update();
+
+    /**
+     * @return The number of the current version.
+     */
+    std::uint64_t version() const;
+
+private:
+    std::atomic<const Version*> current_;
+    std::mutex update_mutex_;
+};
+
+#endif // CONCURRENT_MENU_HPP
@@ -10,6 +10,9 @@
  */
 
 #include "Dessert.hpp"
+#include "DishInstrumentation.hpp"
+#include "MenuRenderer.hpp"
+#include <utility> // For std::move
 
 /**
 * Default constructor with inheritence from Dish default constructor.
@@ -18,16 +21,13 @@
 * - sweetness_level_: 0
 * - contains_nuts_: False
 */
-Dessert::Dessert() : Dish()
+Dessert::Dessert() : Dessert(allocator_type())
 {
-    this->flavor_profile_ = SWEET;
-    this->sweetness_level_ = 0;
-    this->contains_nuts_ = false;
 }
 
 /**
 * Parameterized constructor of Dessert with inheritance from Dish parameterized constructor.
-* @param name A reference to the name of the dish.
+* @param name The name of the dish, copied into the dish's memory resource.
 * @param ingredients A reference to a list of ingredients (default is
 empty list).
 * @param prep_time The preparation time in minutes (default is 0).
@@ -37,26 +37,108 @@ with default value OTHER.
 * @param flavor_profile The flavor profile of the dessert (a FlavorProfile enum)
 * @param sweetness_level The sweetness level
 * @param contains_nuts A reference to whether the dessert contains nuts
-Accessors and Mutators:
+* @param alloc The allocator the dish takes its memory from (default is
+the default memory resource).
 * @post The private members are set to the values of the corresponding
 parameters.
 */
-Dessert::Dessert(const std::string& name, const std::vector<std::string>& ingredients, const int& prep_time, const double& price, const CuisineType cuisine_type, const FlavorProfile flavor_profile, const int& sweetness_level, const bool& contains_nuts) : Dish(name, ingredients, prep_time, price, cuisine_type)
+Dessert::Dessert(std::string_view name, const std::vector<std::string>& ingredients, const int& prep_time, const double& price, const CuisineType cuisine_type, const FlavorProfile flavor_profile, const int& sweetness_level, const bool& contains_nuts, const allocator_type& alloc) : Dish(name, ingredients, prep_time, price, cuisine_type, alloc)
 {
-    this->flavor_profile_= flavor_profile;
+    setCourse(Course::DESSERT);
+    setStyle(flavor_profile);
     this->sweetness_level_ = sweetness_level;
-    this->contains_nuts_ = contains_nuts;
+    setFlag(kContainsNutsFlag, contains_nuts);
+    DISH_COUNT(DESSERT, CONSTRUCTIONS);
+}
+
+/**
+* Default constructor with a memory resource.
+* @param alloc The allocator the dessert takes its memory from.
+* @post The private members are set to the same values as the default
+constructor.
+*/
+Dessert::Dessert(const allocator_type& alloc) : Dish(alloc), sweetness_level_(0)
+{
+    setCourse(Course::DESSERT);
+    setStyle(SWEET);
+    DISH_COUNT(DESSERT, CONSTRUCTIONS);
+}
+
+/**
+* Copy constructor.
+* @param other A reference to the dessert to copy.
+* @param alloc The allocator the copy takes its memory from (default is
+the default memory resource).
+*/
+Dessert::Dessert(const Dessert& other, const allocator_type& alloc) : Dish(other, alloc), sweetness_level_(other.sweetness_level_)
+{
+    assignAttributes(other);
+    DISH_COUNT(DESSERT, COPIES);
+}
+
+/**
+* Move constructor, the new dessert keeps the memory resource of `other`.
+* @param other The dessert to move from.
+*/
+Dessert::Dessert(Dessert&& other) noexcept : Dish(std::move(other)), sweetness_level_(other.sweetness_level_)
+{
+    assignAttributes(other);
+    DISH_COUNT(DESSERT, MOVES);
+}
+
+/**
+* Move constructor with a memory resource.
+* @param other The dessert to move from.
+* @param alloc The allocator of the new dessert, the members are copied
+if it differs from the one of `other`.
+*/
+Dessert::Dessert(Dessert&& other, const allocator_type& alloc) : Dish(std::move(other), alloc), sweetness_level_(other.sweetness_level_)
+{
+    assignAttributes(other);
+    DISH_COUNT(DESSERT, MOVES);
+}
+
+/**
+* Copy assignment operator.
+* @param other A reference to the dessert to copy.
+* @return A reference to this dessert.
+*/
+Dessert& Dessert::operator=(const Dessert& other)
+{
+    Change change(*this, DishObserver::Field::ALL);
+    assignDish(other);
+    assignAttributes(other);
+    sweetness_level_ = other.sweetness_level_;
+    DISH_COUNT(DESSERT, COPIES);
+    return *this;
+}
+
+/**
+* Move assignment operator.
+* @param other The dessert to move from.
+* @return A reference to this dessert.
+*/
+Dessert& Dessert::operator=(Dessert&& other)
+{
+    Change change(*this, DishObserver::Field::ALL);
+    Change source_change(other, DishObserver::Field::ALL);
+    assignDish(std::move(other));
+    assignAttributes(other);
+    sweetness_level_ = other.sweetness_level_;
+    DISH_COUNT(DESSERT, MOVES);
+    return *this;
 }
 
 /**
  * Sets the flavor profile of the dessert.
  * @param flavor_profile The new flavor profile.
- * @post Sets the private member `flavor_profile_` to the value of the
+ * @post Sets the style bits of the attribute word to the value of the
 parameter.
  */
 void Dessert::setFlavorProfile(const FlavorProfile flavor_profile)
 {
-    this->flavor_profile_ = flavor_profile;
+    Change change(*this, DishObserver::Field::FLAVOR_PROFILE);
+    setStyle(flavor_profile);
 }
 
 /**
@@ -64,7 +146,7 @@ void Dessert::setFlavorProfile(const FlavorProfile flavor_profile)
  */
 Dessert::FlavorProfile Dessert::getFlavorProfile() const
 {
-    return flavor_profile_;
+    return static_cast<FlavorProfile>(getStyle());
 }
 
 /**
@@ -76,6 +158,7 @@ parameter.
  */
 void Dessert::setSweetnessLevel(const int& sweetness_level)
 {
+    Change change(*this, DishObserver::Field::SWEETNESS_LEVEL);
     this->sweetness_level_ = sweetness_level;
 }
 
@@ -91,12 +174,13 @@ int Dessert::getSweetnessLevel() const
  * Sets the contains_nuts flag of the dessert.
  * @param contains_nuts A boolean indicating if the dessert contains
 nuts.
- * @post Sets the private member `contains_nuts_` to the value of the
+ * @post Sets the contains-nuts flag of the attribute word to the value of the
 parameter.
  */
 void Dessert::setContainsNuts(const bool& contains_nuts)
 {
-    this->contains_nuts_ = contains_nuts;
+    Change change(*this, DishObserver::Field::CONTAINS_NUTS);
+    setFlag(kContainsNutsFlag, contains_nuts);
 }
 
 /**
@@ -104,7 +188,7 @@ void Dessert::setContainsNuts(const bool& contains_nuts)
  */
 bool Dessert::containsNuts() const
 {
-    return contains_nuts_;
+    return getFlag(kContainsNutsFlag);
 }
 
     // Helper function to display outputs
@@ -113,36 +197,8 @@ bool Dessert::containsNuts() const
      */
 void Dessert::displayDessert() const
 {
-    std::cout << "Flavor Profile: ";
-    if (flavor_profile_== 0)
-    {
-        std::cout << "SWEET" << std::endl;
-    }
-    if (flavor_profile_ == 1)
-    {
-        std::cout << "BITTER" << std::endl;
-    }
-    if (flavor_profile_ == 2)
-    {
-        std::cout << "SOUR" << std::endl;
-    }
-    if (flavor_profile_ == 2)
-    {
-        std::cout << "SALTY" << std::endl;
-    }
-    if (flavor_profile_ == 3)
-    {
-        std::cout << "UMAMI" << std::endl;
-    }
-
-    std::cout << "Sweetness Level: " << getSweetnessLevel() << std::endl;
-    std::cout << "Contains Nuts: ";
-    if (containsNuts() == 1)
-    {
-        std::cout << "True" << std::endl;
-    }
-    else
-    {
-        std::cout << "False" << std::endl;
-    }
+    OStreamSink sink(std::cout);
+    MenuRenderer renderer(sink);
+    renderer.renderDessert(*this);
+    renderer.flush();
 }
@@ -17,6 +17,7 @@
 #include "Dish.hpp"
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <iomanip> // For std::fixed and std::setprecision
 #include <cctype>  // For std::isalpha, std::isspace
@@ -38,7 +39,7 @@ public:
 
 /**
 * Parameterized constructor of Dessert with inheritance from Dish parameterized constructor.
-* @param name A reference to the name of the dish.
+* @param name The name of the dish, copied into the dish's memory resource.
 * @param ingredients A reference to a list of ingredients (default is
 empty list).
 * @param prep_time The preparation time in minutes (default is 0).
@@ -48,16 +49,53 @@ with default value OTHER.
 * @param flavor_profile The flavor profile of the dessert (a FlavorProfile enum)
 * @param sweetness_level The sweetness level
 * @param contains_nuts A reference to whether the dessert contains nuts
-Accessors and Mutators:
+* @param alloc The allocator the dish takes its memory from (default is
+the default memory resource).
 * @post The private members are set to the values of the corresponding
 parameters.
 */
-    Dessert(const std::string& name, const std::vector<std::string>& ingredients, const int& prep_time, const double& price, const CuisineType cuisine_type, const FlavorProfile flavor_profile, const int& sweetness_level, const bool& contains_nuts);
+    Dessert(std::string_view name, const std::vector<std::string>& ingredients, const int& prep_time, const double& price, const CuisineType cuisine_type, const FlavorProfile flavor_profile, const int& sweetness_level, const bool& contains_nuts, const allocator_type& alloc = {});
+
+/**
+* Default constructor with a memory resource.
+* @param alloc The allocator the dessert takes its memory from.
+* @post The private members are set to the same values as the default
+constructor.
+*/
+    explicit Dessert(const allocator_type& alloc);
+
+/**
+* Copy constructor.
+* @param other A reference to the dessert to copy.
+* @param alloc The allocator the copy takes its memory from (default is
+the default memory resource).
+*/
+    Dessert(const Dessert& other, const allocator_type& alloc = {});
+
+/**
+* Move constructor, the new dessert keeps the memory resource of `other`.
+*/
+    Dessert(Dessert&& other) noexcept;
+
+/**
+* Move constructor with a memory resource.
+* @param other The dessert to move from.
+* @param alloc The allocator of the new dessert, the members are copied
+if it differs from the one of `other`.
+*/
+    Dessert(Dessert&& other, const allocator_type& alloc);
+
+/**
+* Assignment operators. Each dessert keeps its own observer, which sees the
+assignment as a change of ALL fields.
+*/
+    Dessert& operator=(const Dessert& other);
+    Dessert& operator=(Dessert&& other);
 
 /**
  * Sets the flavor profile of the dessert.
  * @param flavor_profile The new flavor profile.
- * @post Sets the private member `flavor_profile_` to the value of the
+ * @post Sets the style bits of the attribute word to the value of the
 parameter.
  */
     void setFlavorProfile(const FlavorProfile flavor_profile_);
@@ -85,7 +123,7 @@ parameter.
  * Sets the contains_nuts flag of the dessert.
  * @param contains_nuts A boolean indicating if the dessert contains
 nuts.
- * @post Sets the private member `contains_nuts_` to the value of the
+ * @post Sets the contains-nuts flag of the attribute word to the value of the
 parameter.
  */
     void setContainsNuts(const bool& contains_nuts_);
@@ -104,9 +142,7 @@ parameter.
 
 
 private:
-    FlavorProfile flavor_profile_;
-    int sweetness_level_;
-    bool contains_nuts_;
+    int sweetness_level_;  // the flavor profile and contains-nuts flag live in the attribute word
 };
 
 #endif // DESSERT_HPP
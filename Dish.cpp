@@ -10,28 +10,149 @@
  */
 
 #include "Dish.hpp"
+#include "DishEnums.hpp"
+#include "DishInstrumentation.hpp"
+#include "MenuRenderer.hpp"
+#include "NameValidation.hpp"
 #include <iostream>
-#include <iomanip> // For std::fixed and std::setprecision
-#include <cctype>  // For std::isalpha, std::isspace
+#include <utility> // For std::move
 
 // Default Constructor
 Dish::Dish() 
-    : name_("UNKNOWN"), ingredients_({}), prep_time_(0), price_(0.0), cuisine_type_(CuisineType::OTHER) {
+    : Dish(allocator_type()) {
+}
+
+Dish::Dish(const allocator_type& alloc)
+    : name_("UNKNOWN", alloc), ingredient_ids_(alloc), prep_time_(0), price_(0.0), attributes_(static_cast<std::uint32_t>(CuisineType::OTHER) << kCuisineTypeShift), observer_(nullptr) {
+    DISH_COUNT(DISH, CONSTRUCTIONS);
 }
 
 // Parameterized Constructor
-Dish::Dish(const std::string& name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type)
-    : ingredients_(ingredients), prep_time_(prep_time), price_(price), cuisine_type_(cuisine_type) {
+Dish::Dish(std::string_view name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type, const allocator_type& alloc)
+    : name_(alloc), ingredient_ids_(alloc), prep_time_(prep_time), price_(price), attributes_(static_cast<std::uint32_t>(cuisine_type) << kCuisineTypeShift), observer_(nullptr) {
     setName(name);  // Use setName to validate the name
+    internIngredients(ingredients);
+    DISH_COUNT(DISH, CONSTRUCTIONS);
+    DISH_COUNT_HEAP(DISH, name_);
+    DISH_COUNT_HEAP(DISH, ingredient_ids_);
+}
+
+// Copy and Move Constructors
+Dish::Dish(const Dish& other, const allocator_type& alloc)
+    : name_(other.name_, alloc), ingredient_ids_(other.ingredient_ids_, alloc), prep_time_(other.prep_time_), price_(other.price_), attributes_(other.attributes_ & kCuisineTypeMask), observer_(nullptr) {
+    DISH_COUNT(DISH, COPIES);
+    DISH_COUNT_HEAP(DISH, name_);
+    DISH_COUNT_HEAP(DISH, ingredient_ids_);
+}
+
+Dish::Dish(Dish&& other) noexcept
+    : name_(std::move(other.name_)), ingredient_ids_(std::move(other.ingredient_ids_)), prep_time_(other.prep_time_), price_(other.price_), attributes_(other.attributes_ & kCuisineTypeMask), observer_(other.observer_) {
+    DISH_COUNT(DISH, MOVES);
+    other.observer_ = nullptr;
+    if (observer_ != nullptr) {
+        observer_->dishMoved(other, *this);
+    }
+}
+
+Dish::Dish(Dish&& other, const allocator_type& alloc)
+    : name_(std::move(other.name_), alloc), ingredient_ids_(std::move(other.ingredient_ids_), alloc), prep_time_(other.prep_time_), price_(other.price_), attributes_(other.attributes_ & kCuisineTypeMask), observer_(other.observer_) {
+    DISH_COUNT(DISH, MOVES);
+    other.observer_ = nullptr;
+    if (observer_ != nullptr) {
+        observer_->dishMoved(other, *this);
+    }
+}
+
+// Destructor
+Dish::~Dish() {
+    if (observer_ != nullptr) {
+        observer_->dishDestroyed(*this);
+    }
+}
+
+// Assignment Operators
+Dish& Dish::operator=(const Dish& other) {
+    Change change(*this, DishObserver::Field::ALL);
+    assignDish(other);
+    return *this;
+}
+
+Dish& Dish::operator=(Dish&& other) {
+    Change change(*this, DishObserver::Field::ALL);
+    Change source_change(other, DishObserver::Field::ALL);
+    assignDish(std::move(other));
+    return *this;
+}
+
+void Dish::assignDish(const Dish& other) {
+    DISH_COUNT(DISH, COPIES);
+    name_ = other.name_;
+    ingredient_ids_ = other.ingredient_ids_;
+    prep_time_ = other.prep_time_;
+    price_ = other.price_;
+    attributes_ = (attributes_ & ~kCuisineTypeMask) | (other.attributes_ & kCuisineTypeMask);
+}
+
+void Dish::assignDish(Dish&& other) {
+    DISH_COUNT(DISH, MOVES);
+    name_ = std::move(other.name_);
+    ingredient_ids_ = std::move(other.ingredient_ids_);
+    prep_time_ = other.prep_time_;
+    price_ = other.price_;
+    attributes_ = (attributes_ & ~kCuisineTypeMask) | (other.attributes_ & kCuisineTypeMask);
+}
+
+Dish::allocator_type Dish::get_allocator() const {
+    return name_.get_allocator();
 }
 
 // Accessor Functions
 std::string Dish::getName() const {
-    return name_;
+    std::string name(name_.data(), name_.size());
+    DISH_COUNT(GET_NAME, CALLS);
+    DISH_COUNT_HEAP(GET_NAME, name);
+    return name;
 }
 
 std::vector<std::string> Dish::getIngredients() const {
-    return ingredients_;
+    const SymbolTable& table = SymbolTable::ingredients();
+    std::vector<std::string> ingredients;
+    ingredients.reserve(ingredient_ids_.size());
+    for (SymbolTable::Id id : ingredient_ids_) {
+        ingredients.push_back(table.name(id));
+        DISH_COUNT_HEAP(GET_INGREDIENTS, ingredients.back());
+    }
+    DISH_COUNT(GET_INGREDIENTS, CALLS);
+    DISH_COUNT_HEAP(GET_INGREDIENTS, ingredients);
+    return ingredients;
+}
+
+const Dish::IngredientIds& Dish::getIngredientIds() const {
+    return ingredient_ids_;
+}
+
+bool Dish::hasIngredient(SymbolTable::Id ingredient_id) const {
+    for (SymbolTable::Id id : ingredient_ids_) {
+        if (id == ingredient_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Dish::hasIngredient(const std::string& ingredient) const {
+    SymbolTable::Id id;
+    return SymbolTable::ingredients().find(ingredient, id) && hasIngredient(id);
+}
+
+std::vector<SymbolTable::Id> Dish::getCommonIngredientIds(const Dish& other) const {
+    std::vector<SymbolTable::Id> common;
+    for (SymbolTable::Id id : ingredient_ids_) {
+        if (other.hasIngredient(id)) {
+            common.push_back(id);
+        }
+    }
+    return common;
 }
 
 int Dish::getPrepTime() const {
@@ -43,19 +164,45 @@ double Dish::getPrice() const {
 }
 
 std::string Dish::getCuisineType() const {
-    switch (cuisine_type_) {
-        case CuisineType::ITALIAN: return "ITALIAN";
-        case CuisineType::MEXICAN: return "MEXICAN";
-        case CuisineType::CHINESE: return "CHINESE";
-        case CuisineType::INDIAN: return "INDIAN";
-        case CuisineType::AMERICAN: return "AMERICAN";
-        case CuisineType::FRENCH: return "FRENCH";
-        default: return "OTHER";
-    }
+    std::string_view label = DishEnums::toString(getCuisineTypeEnum());
+    std::string cuisine_type(label.empty() ? DishEnums::toString(CuisineType::OTHER) : label);
+    DISH_COUNT(GET_CUISINE_TYPE, CALLS);
+    DISH_COUNT_HEAP(GET_CUISINE_TYPE, cuisine_type);
+    return cuisine_type;
+}
+
+Dish::CuisineType Dish::getCuisineTypeEnum() const {
+    return static_cast<CuisineType>((attributes_ & kCuisineTypeMask) >> kCuisineTypeShift);
+}
+
+Dish::Course Dish::getCourse() const {
+    return static_cast<Course>((attributes_ & kCourseMask) >> kCourseShift);
+}
+
+std::uint32_t Dish::getAttributes() const {
+    return attributes_;
+}
+
+// View Functions
+std::string_view Dish::getNameView() const {
+    return name_;
+}
+
+std::size_t Dish::getIngredientCount() const {
+    return ingredient_ids_.size();
+}
+
+std::string_view Dish::getIngredientView(std::size_t i) const {
+    return SymbolTable::ingredients().name(ingredient_ids_[i]);
+}
+
+ArrayView<SymbolTable::Id> Dish::getIngredientIdsView() const {
+    return ArrayView<SymbolTable::Id>(ingredient_ids_);
 }
 
 // Mutator Functions
-void Dish::setName(const std::string& name) {
+void Dish::setName(std::string_view name) {
+    Change change(*this, DishObserver::Field::NAME);
     if (isValidName(name)) {
         name_ = name;
     } else {
@@ -64,43 +211,83 @@ void Dish::setName(const std::string& name) {
 }
 
 void Dish::setIngredients(const std::vector<std::string>& ingredients) {
-    ingredients_ = ingredients;
+    Change change(*this, DishObserver::Field::INGREDIENTS);
+    internIngredients(ingredients);
+}
+
+void Dish::setIngredientIds(ArrayView<SymbolTable::Id> ingredient_ids) {
+    Change change(*this, DishObserver::Field::INGREDIENTS);
+    ingredient_ids_.assign(ingredient_ids.begin(), ingredient_ids.end());
 }
 
 void Dish::setPrepTime(const int& prep_time) {
+    Change change(*this, DishObserver::Field::PREP_TIME);
     prep_time_ = prep_time;
 }
 
 void Dish::setPrice(const double& price) {
+    Change change(*this, DishObserver::Field::PRICE);
     price_ = price;
 }
 
 void Dish::setCuisineType(const CuisineType& cuisine_type) {
-    cuisine_type_ = cuisine_type;
+    Change change(*this, DishObserver::Field::CUISINE_TYPE);
+    attributes_ = (attributes_ & ~kCuisineTypeMask) | (static_cast<std::uint32_t>(cuisine_type) << kCuisineTypeShift);
+}
+
+// Observation Functions
+void Dish::setObserver(DishObserver* observer) {
+    observer_ = observer;
+}
+
+DishObserver* Dish::getObserver() const {
+    return observer_;
 }
 
 // Display Function
 void Dish::display() const {
-    std::cout << "Dish Name: " << name_ << std::endl;
-    std::cout << "Ingredients: ";
-    for (size_t i = 0; i < ingredients_.size(); ++i) {
-        std::cout << ingredients_[i];
-        if (i != ingredients_.size() - 1) {
-            std::cout << ", ";
-        }
+    OStreamSink sink(std::cout);
+    MenuRenderer renderer(sink);
+    renderer.renderDish(*this);
+    renderer.flush();  // One flush for the whole dish instead of one per line
+}
+
+// Attribute Word Helpers
+void Dish::setCourse(Course course) {
+    attributes_ = (attributes_ & ~kCourseMask) | (static_cast<std::uint32_t>(course) << kCourseShift);
+}
+
+void Dish::setStyle(unsigned style) {
+    attributes_ = (attributes_ & ~kStyleMask) | ((style << kStyleShift) & kStyleMask);
+}
+
+unsigned Dish::getStyle() const {
+    return (attributes_ & kStyleMask) >> kStyleShift;
+}
+
+void Dish::setFlag(std::uint32_t flag, bool value) {
+    attributes_ = value ? (attributes_ | flag) : (attributes_ & ~flag);
+}
+
+bool Dish::getFlag(std::uint32_t flag) const {
+    return (attributes_ & flag) != 0;
+}
+
+void Dish::assignAttributes(const Dish& other) {
+    attributes_ = other.attributes_;
+}
+
+// Helper function to intern a list of ingredient names
+void Dish::internIngredients(const std::vector<std::string>& ingredients) {
+    SymbolTable& table = SymbolTable::ingredients();
+    ingredient_ids_.clear();
+    ingredient_ids_.reserve(ingredients.size());
+    for (const std::string& ingredient : ingredients) {
+        ingredient_ids_.push_back(table.intern(ingredient));
     }
-    std::cout << std::endl;
-    std::cout << "Preparation Time: " << prep_time_ << " minutes" << std::endl;
-    std::cout << std::fixed << std::setprecision(2) << "Price: $" << price_ << std::endl;
-    std::cout << "Cuisine Type: " << getCuisineType() << std::endl;
 }
 
 // Helper function to check if the name is valid
-bool Dish::isValidName(const std::string& name) const {
-    for (char c : name) {
-        if (!std::isalpha(c) && !std::isspace(c)) {  // Check if each character is a letter or space
-            return false;  // Name contains non-alphabetic characters other than spaces
-        }
-    }
-    return true;  // Name is valid
+bool Dish::isValidName(std::string_view name) {
+    return NameValidation::firstInvalid(name) == NameValidation::kValid;  // Letters and whitespace only
 }
@@ -5,6 +5,18 @@
  * The Dish class includes attributes such as name, ingredients, preparation time, price, and cuisine type.
  * It provides constructors, accessor and mutator functions, and a display function to manage and present
  * the details of a dish.
+ *
+ * Dish is allocator-aware: its strings and lists come from a std::pmr memory resource, the default heap
+ * resource unless another one is passed to a constructor, so a whole menu can share one arena. Up to
+ * kInlineIngredients ingredient ids are kept inside the dish (see SmallVector), which covers most dishes
+ * without any block for the list.
+ *
+ * The course, the cuisine type, the course-specific enum (ServingStyle, CookingMethod or FlavorProfile) and
+ * the dietary flags are packed into one 32-bit attribute word, so a filter over a mixed menu can test any
+ * combination of them with one mask and compare (see AttributeFilter) without knowing the class of a dish.
+ *
+ * A dish can be watched by a DishObserver, which is notified around every change made through a setter.
+ * A copy is not observed; a moved-to dish takes over the observer of the dish it was moved from.
  * 
  * @date September 17th, 2024
  * @author Kun Feng Wei
@@ -13,7 +25,15 @@
 #ifndef DISH_HPP
 #define DISH_HPP
 
+#include "ArrayView.hpp"
+#include "DishObserver.hpp"
+#include "SmallVector.hpp"
+#include "SymbolTable.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class Dish {
@@ -21,6 +41,29 @@ public:
     // CuisineType enum definition
     enum class CuisineType { ITALIAN, MEXICAN, CHINESE, INDIAN, AMERICAN, FRENCH, OTHER };
 
+    // Course enum definition, the class a dish was constructed as
+    enum class Course : std::uint8_t { DISH, APPETIZER, MAIN_COURSE, DESSERT };
+
+    // Attribute word layout, see getAttributes(); bits 11-15 and 24-31 are unused and zero
+    static constexpr std::uint32_t kCourseShift = 0;
+    static constexpr std::uint32_t kCourseMask = 0x3u << kCourseShift;
+    static constexpr std::uint32_t kCuisineTypeShift = 2;
+    static constexpr std::uint32_t kCuisineTypeMask = 0x7u << kCuisineTypeShift;
+    static constexpr std::uint32_t kStyleShift = 5;       // ServingStyle, CookingMethod or FlavorProfile
+    static constexpr std::uint32_t kStyleMask = 0x7u << kStyleShift;
+    static constexpr std::uint32_t kVegetarianFlag = 1u << 8;     // appetizers only
+    static constexpr std::uint32_t kGlutenFreeFlag = 1u << 9;     // main courses only
+    static constexpr std::uint32_t kContainsNutsFlag = 1u << 10;  // desserts only
+    static constexpr std::uint32_t kSideDishCategoryShift = 16;   // main courses only, see MainCourse::sideDishCategoryBit()
+    static constexpr std::uint32_t kSideDishCategoryMask = 0xFFu << kSideDishCategoryShift;
+
+    // Allocator type definition, lets std::pmr containers pass their memory resource to the dishes they hold
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    // Ingredient list type definition, the ids of up to kInlineIngredients ingredients are stored inline
+    static constexpr std::size_t kInlineIngredients = 8;
+    using IngredientIds = SmallVector<SymbolTable::Id, kInlineIngredients>;
+
     // Constructors
     /**
      * Default constructor.
@@ -33,16 +76,62 @@ public:
      */
     Dish();
 
+    /**
+     * Default constructor with a memory resource.
+     * @param alloc The allocator the dish takes its memory from.
+     * @post The private members are set to the same values as the default constructor.
+     */
+    explicit Dish(const allocator_type& alloc);
+
     /**
      * Parameterized constructor.
-     * @param name A reference to the name of the dish.
+     * @param name The name of the dish, copied into the dish's memory resource.
      * @param ingredients A reference to a list of ingredients (default is an empty list).
      * @param prep_time The preparation time in minutes (default is 0).
      * @param price The price of the dish (default is 0.0).
      * @param cuisine_type The cuisine type of the dish (a CuisineType enum) with default value OTHER.
+     * @param alloc The allocator the dish takes its memory from (default is the default memory resource).
      * @post The private members are set to the values of the corresponding parameters.
      */
-    Dish(const std::string& name, const std::vector<std::string>& ingredients = {}, int prep_time = 0, double price = 0.0, CuisineType cuisine_type = CuisineType::OTHER);
+    Dish(std::string_view name, const std::vector<std::string>& ingredients = {}, int prep_time = 0, double price = 0.0, CuisineType cuisine_type = CuisineType::OTHER, const allocator_type& alloc = {});
+
+    /**
+     * Copy constructor.
+     * @param other A reference to the dish to copy.
+     * @param alloc The allocator the copy takes its memory from (default is the default memory resource).
+     */
+    Dish(const Dish& other, const allocator_type& alloc = {});
+
+    /**
+     * Move constructor.
+     * @param other The dish to move from, it keeps its memory resource. Its observer moves to the new dish.
+     */
+    Dish(Dish&& other) noexcept;
+
+    /**
+     * Move constructor with a memory resource.
+     * @param other The dish to move from. Its observer moves to the new dish.
+     * @param alloc The allocator of the new dish, the members are copied if it differs from the one of `other`.
+     */
+    Dish(Dish&& other, const allocator_type& alloc);
+
+    /**
+     * Destructor.
+     * Notifies the observer, if any.
+     */
+    ~Dish();
+
+    /**
+     * Assignment operators. Each dish keeps its own observer, which sees the assignment as a change of ALL
+     * fields (for a move, of both dishes).
+     */
+    Dish& operator=(const Dish& other);
+    Dish& operator=(Dish&& other);
+
+    /**
+     * @return The allocator the dish takes its memory from.
+     */
+    allocator_type get_allocator() const;
 
     // Accessors
     /**
@@ -51,10 +140,33 @@ public:
     std::string getName() const;
 
     /**
-     * @return The list of ingredients used in the dish.
+     * @return The list of ingredients used in the dish, resolved from the ingredient table.
      */
     std::vector<std::string> getIngredients() const;
 
+    /**
+     * @return The ids of the ingredients used in the dish (see SymbolTable::ingredients()).
+     */
+    const IngredientIds& getIngredientIds() const;
+
+    /**
+     * @param ingredient_id The id of an ingredient.
+     * @return True if the dish uses the ingredient, false otherwise.
+     */
+    bool hasIngredient(SymbolTable::Id ingredient_id) const;
+
+    /**
+     * @param ingredient The name of an ingredient.
+     * @return True if the dish uses the ingredient, false otherwise.
+     */
+    bool hasIngredient(const std::string& ingredient) const;
+
+    /**
+     * @param other A reference to another dish.
+     * @return The ids of the ingredients used by both dishes, in the order they appear in this dish.
+     */
+    std::vector<SymbolTable::Id> getCommonIngredientIds(const Dish& other) const;
+
     /**
      * @return The preparation time in minutes.
      */
@@ -70,21 +182,71 @@ public:
      */
     std::string getCuisineType() const;
 
+    /**
+     * @return The cuisine type of the dish (as an enum).
+     */
+    CuisineType getCuisineTypeEnum() const;
+
+    /**
+     * @return The class the dish was constructed as.
+     */
+    Course getCourse() const;
+
+    /**
+     * @return The attribute word: the course, cuisine type, course-specific enum and dietary flags packed
+     * at the k...Shift / k...Mask / k...Flag positions.
+     */
+    std::uint32_t getAttributes() const;
+
+    // Views
+    // The view accessors return without allocating or copying. A view stays valid until the member it
+    // refers to is modified (setName, setIngredients, ...), moved or destroyed: short names and up to
+    // IngredientIds::kInlineCapacity ingredient ids live inside the dish, so moving the dish moves them
+    // too. Ingredient names live in the ingredient table and stay valid for the lifetime of the program.
+    /**
+     * @return A view of the name of the dish.
+     */
+    std::string_view getNameView() const;
+
+    /**
+     * @return The number of ingredients used in the dish.
+     */
+    std::size_t getIngredientCount() const;
+
+    /**
+     * @param i The position of the ingredient, must be less than getIngredientCount().
+     * @return A view of the name of the ingredient at position i.
+     */
+    std::string_view getIngredientView(std::size_t i) const;
+
+    /**
+     * @return A view of the ids of the ingredients used in the dish, valid until the ingredients are
+     * modified, moved or destroyed.
+     */
+    ArrayView<SymbolTable::Id> getIngredientIdsView() const;
+
     // Mutators
     /**
      * Sets the name of the dish.
-     * @param name A reference to the new name of the dish.
+     * @param name The new name of the dish.
      * @post Sets the private member `name_` to the value of the parameter. If the name contains non-alphabetic characters, it is set to "UNKNOWN".
      */
-    void setName(const std::string& name);
+    void setName(std::string_view name);
 
     /**
      * Sets the list of ingredients.
      * @param ingredients A reference to the new list of ingredients.
-     * @post Sets the private member `ingredients_` to the value of the parameter.
+     * @post Sets the private member `ingredient_ids_` to the ids of the ingredients, interning new names.
      */
     void setIngredients(const std::vector<std::string>& ingredients);
 
+    /**
+     * Sets the list of ingredients from ingredient ids.
+     * @param ingredient_ids A view of the ids of the new ingredients (see SymbolTable::ingredients()).
+     * @post Sets the private member `ingredient_ids_` to the value of the parameter.
+     */
+    void setIngredientIds(ArrayView<SymbolTable::Id> ingredient_ids);
+
     /**
      * Sets the preparation time.
      * @param prep_time The new preparation time in minutes.
@@ -102,7 +264,7 @@ public:
     /**
      * Sets the cuisine type of the dish.
      * @param cuisine_type The new cuisine type of the dish (a CuisineType enum).
-     * @post Sets the private member `cuisine_type_` to the value of the parameter.
+     * @post Sets the cuisine type bits of the private member `attributes_` to the value of the parameter.
      */
     void setCuisineType(const CuisineType& cuisine_type);
 
@@ -120,20 +282,75 @@ public:
      */
     void display() const;
 
-private:
-    std::string name_;
-    std::vector<std::string> ingredients_;
-    int prep_time_;
-    double price_;
-    CuisineType cuisine_type_;
-
-    // Helper function to check if the name is valid
     /**
-     * Checks if the name is valid.
+     * Checks if the name is valid. setName() and the constructors fall back to "UNKNOWN" for invalid names;
+     * importers use this to reject a record instead.
      * @param name The name to be validated.
      * @return True if the name contains only alphabetic characters and spaces; false otherwise.
+     * NameValidation::firstInvalid() gives the offset of the offending character and validate() checks a batch.
+     */
+    static bool isValidName(std::string_view name);
+
+    // Observation
+    /**
+     * Sets the observer notified of changes to the dish.
+     * @param observer A pointer to the observer, or nullptr to stop observing. The observer must outlive the
+     * dish or be removed first.
      */
-    bool isValidName(const std::string& name) const;
+    void setObserver(DishObserver* observer);
+
+    /**
+     * @return The observer of the dish, nullptr if there is none.
+     */
+    DishObserver* getObserver() const;
+
+protected:
+    // Notifies the observer before a change when constructed and after it when destroyed
+    class Change {
+    public:
+        Change(const Dish& dish, DishObserver::Field field) : dish_(dish), field_(field) {
+            if (dish_.observer_ != nullptr) {
+                dish_.observer_->dishChanging(dish_, field_);
+            }
+        }
+
+        ~Change() {
+            if (dish_.observer_ != nullptr) {
+                dish_.observer_->dishChanged(dish_, field_);
+            }
+        }
+
+        Change(const Change&) = delete;
+        Change& operator=(const Change&) = delete;
+
+    private:
+        const Dish& dish_;
+        DishObserver::Field field_;
+    };
+
+    // Assign the Dish members without notifying, for the assignment operators of derived classes.
+    // Only the cuisine type is taken from the attribute word of `other`.
+    void assignDish(const Dish& other);
+    void assignDish(Dish&& other);
+
+    // Attribute word helpers for derived classes
+    void setCourse(Course course);
+    void setStyle(unsigned style);
+    unsigned getStyle() const;
+    void setFlag(std::uint32_t flag, bool value);
+    bool getFlag(std::uint32_t flag) const;
+    void assignAttributes(const Dish& other);  // copies the whole word, for dishes of the same class
+
+private:
+    // Helper function to intern a list of ingredient names
+    void internIngredients(const std::vector<std::string>& ingredients);
+
+    std::pmr::string name_;
+    IngredientIds ingredient_ids_;
+    int prep_time_;
+    double price_;
+    std::uint32_t attributes_;
+    DishObserver* observer_;
 };
 
 #endif // DISH_HPP
@@ -0,0 +1,266 @@
+/**
+ * @file DishCatalog.cpp
+ * @brief This file contains the implementation of the DishCatalog class, a columnar container for large menus.
+ *
+ * Every add() call appends one value to each column so that all columns always have the same length.
+ * Ingredient and side-dish lists are appended to shared pools and addressed through 32-bit offset columns;
+ * add() checks that a pool stays within those offsets before it appends anything to a column.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "DishCatalog.hpp"
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// Throws if appending added entries to a pool of the given size would overflow its 32-bit offsets
+void checkPoolOffset(std::size_t size, std::size_t added, const char* pool) {
+    if (added > std::numeric_limits<std::uint32_t>::max() - size) {
+        throw std::length_error(std::string("DishCatalog: the ") + pool + " pool outgrew its 32-bit offsets");
+    }
+}
+
+} // namespace
+
+// Row Functions
+DishCatalog::Row::Row(const DishCatalog& catalog, std::size_t index)
+    : catalog_(&catalog), index_(index) {
+}
+
+std::size_t DishCatalog::Row::index() const {
+    return index_;
+}
+
+DishCatalog::Course DishCatalog::Row::getCourse() const {
+    return catalog_->courses_[index_];
+}
+
+const std::string& DishCatalog::Row::getName() const {
+    return catalog_->names_[index_];
+}
+
+std::size_t DishCatalog::Row::getIngredientCount() const {
+    return catalog_->ingredient_offsets_[index_ + 1] - catalog_->ingredient_offsets_[index_];
+}
+
+const std::string& DishCatalog::Row::getIngredient(std::size_t i) const {
+    return SymbolTable::ingredients().name(getIngredientId(i));
+}
+
+SymbolTable::Id DishCatalog::Row::getIngredientId(std::size_t i) const {
+    return catalog_->ingredient_pool_[catalog_->ingredient_offsets_[index_] + i];
+}
+
+int DishCatalog::Row::getPrepTime() const {
+    return catalog_->prep_times_[index_];
+}
+
+double DishCatalog::Row::getPrice() const {
+    return catalog_->prices_[index_];
+}
+
+Dish::CuisineType DishCatalog::Row::getCuisineTypeEnum() const {
+    return catalog_->cuisine_types_[index_];
+}
+
+Appetizer::ServingStyle DishCatalog::Row::getServingStyle() const {
+    return static_cast<Appetizer::ServingStyle>(styleOf(Course::APPETIZER));
+}
+
+int DishCatalog::Row::getSpicinessLevel() const {
+    return catalog_->spiciness_levels_[index_];
+}
+
+bool DishCatalog::Row::isVegetarian() const {
+    return (catalog_->attributes_[index_] & Dish::kVegetarianFlag) != 0;
+}
+
+MainCourse::CookingMethod DishCatalog::Row::getCookingMethod() const {
+    return static_cast<MainCourse::CookingMethod>(styleOf(Course::MAIN_COURSE));
+}
+
+const std::string& DishCatalog::Row::getProteinType() const {
+    return catalog_->protein_types_[index_];
+}
+
+std::size_t DishCatalog::Row::getSideDishCount() const {
+    return catalog_->side_dish_offsets_[index_ + 1] - catalog_->side_dish_offsets_[index_];
+}
+
+const std::string& DishCatalog::Row::getSideDishName(std::size_t i) const {
+    return SymbolTable::sideDishes().name(getSideDishId(i));
+}
+
+SymbolTable::Id DishCatalog::Row::getSideDishId(std::size_t i) const {
+    return catalog_->side_dish_pool_[catalog_->side_dish_offsets_[index_] + i].name_id;
+}
+
+MainCourse::Category DishCatalog::Row::getSideDishCategory(std::size_t i) const {
+    return catalog_->side_dish_pool_[catalog_->side_dish_offsets_[index_] + i].category;
+}
+
+std::uint32_t DishCatalog::Row::getSideDishCategories() const {
+    return (catalog_->attributes_[index_] & Dish::kSideDishCategoryMask) >> Dish::kSideDishCategoryShift;
+}
+
+bool DishCatalog::Row::isGlutenFree() const {
+    return (catalog_->attributes_[index_] & Dish::kGlutenFreeFlag) != 0;
+}
+
+Dessert::FlavorProfile DishCatalog::Row::getFlavorProfile() const {
+    return static_cast<Dessert::FlavorProfile>(styleOf(Course::DESSERT));
+}
+
+int DishCatalog::Row::getSweetnessLevel() const {
+    return catalog_->sweetness_levels_[index_];
+}
+
+bool DishCatalog::Row::containsNuts() const {
+    return (catalog_->attributes_[index_] & Dish::kContainsNutsFlag) != 0;
+}
+
+unsigned DishCatalog::Row::styleOf(Course course) const {
+    std::uint32_t attributes = catalog_->attributes_[index_];
+    if (static_cast<Course>((attributes & Dish::kCourseMask) >> Dish::kCourseShift) != course) {
+        return 0;  // the first enumerator, as for the subclass default constructors
+    }
+    return (attributes & Dish::kStyleMask) >> Dish::kStyleShift;
+}
+
+// Constructor
+DishCatalog::DishCatalog()
+    : ingredient_offsets_({0}), side_dish_offsets_({0}) {
+}
+
+void DishCatalog::reserve(std::size_t rows) {
+    courses_.reserve(rows);
+    prices_.reserve(rows);
+    prep_times_.reserve(rows);
+    cuisine_types_.reserve(rows);
+    attributes_.reserve(rows);
+    spiciness_levels_.reserve(rows);
+    sweetness_levels_.reserve(rows);
+    names_.reserve(rows);
+    protein_types_.reserve(rows);
+    ingredient_offsets_.reserve(rows + 1);
+    side_dish_offsets_.reserve(rows + 1);
+}
+
+// Insertion Functions
+std::size_t DishCatalog::add(const Dish& dish) {
+    return addDishColumns(dish, Course::DISH);
+}
+
+std::size_t DishCatalog::add(const Appetizer& appetizer) {
+    std::size_t index = addDishColumns(appetizer, Course::APPETIZER);
+    attributes_[index] = appetizer.getAttributes();
+    spiciness_levels_[index] = appetizer.getSpicinessLevel();
+    return index;
+}
+
+std::size_t DishCatalog::add(const MainCourse& main_course) {
+    ArrayView<MainCourse::PackedSideDish> side_dishes = main_course.getPackedSideDishesView();
+    checkPoolOffset(side_dish_pool_.size(), side_dishes.size(), "side dish");
+    std::size_t index = addDishColumns(main_course, Course::MAIN_COURSE);
+    attributes_[index] = main_course.getAttributes();
+    protein_types_[index] = main_course.getProteinTypeView();
+
+    side_dish_pool_.insert(side_dish_pool_.end(), side_dishes.begin(), side_dishes.end());
+    side_dish_offsets_[index + 1] = static_cast<std::uint32_t>(side_dish_pool_.size());
+    return index;
+}
+
+std::size_t DishCatalog::add(const Dessert& dessert) {
+    std::size_t index = addDishColumns(dessert, Course::DESSERT);
+    attributes_[index] = dessert.getAttributes();
+    sweetness_levels_[index] = dessert.getSweetnessLevel();
+    return index;
+}
+
+void DishCatalog::clear() {
+    courses_.clear();
+    prices_.clear();
+    prep_times_.clear();
+    cuisine_types_.clear();
+    attributes_.clear();
+    spiciness_levels_.clear();
+    sweetness_levels_.clear();
+    names_.clear();
+    protein_types_.clear();
+    ingredient_offsets_.assign(1, 0);
+    ingredient_pool_.clear();
+    side_dish_offsets_.assign(1, 0);
+    side_dish_pool_.clear();
+}
+
+// Accessor Functions
+std::size_t DishCatalog::size() const {
+    return courses_.size();
+}
+
+bool DishCatalog::empty() const {
+    return courses_.empty();
+}
+
+DishCatalog::Row DishCatalog::operator[](std::size_t index) const {
+    return Row(*this, index);
+}
+
+const DishCatalog::Course* DishCatalog::courses() const {
+    return courses_.data();
+}
+
+const double* DishCatalog::prices() const {
+    return prices_.data();
+}
+
+const int* DishCatalog::prepTimes() const {
+    return prep_times_.data();
+}
+
+const Dish::CuisineType* DishCatalog::cuisineTypes() const {
+    return cuisine_types_.data();
+}
+
+const std::uint32_t* DishCatalog::attributes() const {
+    return attributes_.data();
+}
+
+const int* DishCatalog::spicinessLevels() const {
+    return spiciness_levels_.data();
+}
+
+const int* DishCatalog::sweetnessLevels() const {
+    return sweetness_levels_.data();
+}
+
+// Helper function to append the shared columns
+std::size_t DishCatalog::addDishColumns(const Dish& dish, Course course) {
+    ArrayView<SymbolTable::Id> ingredient_ids = dish.getIngredientIdsView();
+    checkPoolOffset(ingredient_pool_.size(), ingredient_ids.size(), "ingredient");
+    std::size_t index = courses_.size();
+
+    courses_.push_back(course);
+    prices_.push_back(dish.getPrice());
+    prep_times_.push_back(dish.getPrepTime());
+    cuisine_types_.push_back(dish.getCuisineTypeEnum());
+
+    // A subclass passed as a plain Dish keeps only its cuisine type, the subclass add() overwrites the word
+    attributes_.push_back((dish.getAttributes() & Dish::kCuisineTypeMask) | (static_cast<std::uint32_t>(course) << Dish::kCourseShift));
+
+    // Subclass columns start with the same defaults as the subclass default constructors
+    spiciness_levels_.push_back(0);
+    sweetness_levels_.push_back(0);
+
+    names_.emplace_back(dish.getNameView());
+    protein_types_.emplace_back();
+
+    ingredient_pool_.insert(ingredient_pool_.end(), ingredient_ids.begin(), ingredient_ids.end());
+    ingredient_offsets_.push_back(static_cast<std::uint32_t>(ingredient_pool_.size()));
+    side_dish_offsets_.push_back(side_dish_offsets_.back());
+
+    return index;
+}
@@ -0,0 +1,296 @@
+/**
+ * @file DishCatalog.hpp
+ * @brief This file contains the declaration of the DishCatalog class, a columnar container for large menus.
+ *
+ * The DishCatalog stores every dish field in its own contiguous column (struct-of-arrays) so that bulk
+ * scans such as "price under X and cuisine is ITALIAN" only touch the columns they need. The attribute
+ * word of each dish (see Dish::getAttributes()) is kept as one column, so dietary and style filters over
+ * every course are one masked compare per row. Individual dishes are read back through lightweight Row
+ * handles instead of full Dish copies.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef DISH_CATALOG_HPP
+#define DISH_CATALOG_HPP
+
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class DishCatalog {
+public:
+    // Course type definition, records which class a row was added from
+    using Course = Dish::Course;
+
+    /**
+     * A lightweight handle to one row of the catalog.
+     * A Row only stores the catalog and the row index; every accessor reads straight from the columns.
+     * A Row stays valid until the catalog is modified or destroyed.
+     */
+    class Row {
+    public:
+        Row(const DishCatalog& catalog, std::size_t index);
+
+        /**
+         * @return The position of the row in the catalog.
+         */
+        std::size_t index() const;
+
+        /**
+         * @return The course the row was added as.
+         */
+        Course getCourse() const;
+
+        /**
+         * @return The name of the dish.
+         */
+        const std::string& getName() const;
+
+        /**
+         * @return The number of ingredients used in the dish.
+         */
+        std::size_t getIngredientCount() const;
+
+        /**
+         * @param i The position of the ingredient, must be less than getIngredientCount().
+         * @return The ingredient at position i.
+         */
+        const std::string& getIngredient(std::size_t i) const;
+
+        /**
+         * @param i The position of the ingredient, must be less than getIngredientCount().
+         * @return The id of the ingredient at position i (see SymbolTable::ingredients()).
+         */
+        SymbolTable::Id getIngredientId(std::size_t i) const;
+
+        /**
+         * @return The preparation time in minutes.
+         */
+        int getPrepTime() const;
+
+        /**
+         * @return The price of the dish.
+         */
+        double getPrice() const;
+
+        /**
+         * @return The cuisine type of the dish (as an enum).
+         */
+        Dish::CuisineType getCuisineTypeEnum() const;
+
+        /**
+         * @return The serving style of the appetizer, PLATED for other courses.
+         */
+        Appetizer::ServingStyle getServingStyle() const;
+
+        /**
+         * @return The spiciness level of the appetizer, 0 for other courses.
+         */
+        int getSpicinessLevel() const;
+
+        /**
+         * @return True if the row is a vegetarian appetizer, false otherwise.
+         */
+        bool isVegetarian() const;
+
+        /**
+         * @return The cooking method of the main course, GRILLED for other courses.
+         */
+        MainCourse::CookingMethod getCookingMethod() const;
+
+        /**
+         * @return The protein type of the main course, empty for other courses.
+         */
+        const std::string& getProteinType() const;
+
+        /**
+         * @return The number of side dishes served with the main course, 0 for other courses.
+         */
+        std::size_t getSideDishCount() const;
+
+        /**
+         * @param i The position of the side dish, must be less than getSideDishCount().
+         * @return The name of the side dish at position i.
+         */
+        const std::string& getSideDishName(std::size_t i) const;
+
+        /**
+         * @param i The position of the side dish, must be less than getSideDishCount().
+         * @return The id of the name of the side dish at position i (see SymbolTable::sideDishes()).
+         */
+        SymbolTable::Id getSideDishId(std::size_t i) const;
+
+        /**
+         * @param i The position of the side dish, must be less than getSideDishCount().
+         * @return The category of the side dish at position i.
+         */
+        MainCourse::Category getSideDishCategory(std::size_t i) const;
+
+        /**
+         * @return The categories of the side dishes of the main course, one bit per category (see
+         * MainCourse::sideDishCategoryBit()), 0 for other courses.
+         */
+        std::uint32_t getSideDishCategories() const;
+
+        /**
+         * @return True if the row is a gluten-free main course, false otherwise.
+         */
+        bool isGlutenFree() const;
+
+        /**
+         * @return The flavor profile of the dessert, SWEET for other courses.
+         */
+        Dessert::FlavorProfile getFlavorProfile() const;
+
+        /**
+         * @return The sweetness level of the dessert, 0 for other courses.
+         */
+        int getSweetnessLevel() const;
+
+        /**
+         * @return True if the row is a dessert containing nuts, false otherwise.
+         */
+        bool containsNuts() const;
+
+    private:
+        // Returns the style bits of the attribute word if the row is of the course, 0 otherwise
+        unsigned styleOf(Course course) const;
+
+        const DishCatalog* catalog_;
+        std::size_t index_;
+    };
+
+    /**
+     * Default constructor.
+     * Creates an empty catalog.
+     */
+    DishCatalog();
+
+    /**
+     * Reserves room in every column.
+     * @param rows The number of rows the catalog should hold without reallocating.
+     */
+    void reserve(std::size_t rows);
+
+    /**
+     * Adds a plain dish to the catalog.
+     * @param dish A reference to the dish to copy into the columns.
+     * @return The index of the new row.
+     * @throw std::length_error If the ingredient or side dish pool would pass UINT32_MAX entries, the catalog is unchanged.
+     */
+    std::size_t add(const Dish& dish);
+
+    /**
+     * Adds an appetizer to the catalog.
+     * @param appetizer A reference to the appetizer to copy into the columns.
+     * @return The index of the new row.
+     * @throw std::length_error If the ingredient or side dish pool would pass UINT32_MAX entries, the catalog is unchanged.
+     */
+    std::size_t add(const Appetizer& appetizer);
+
+    /**
+     * Adds a main course to the catalog.
+     * @param main_course A reference to the main course to copy into the columns.
+     * @return The index of the new row.
+     * @throw std::length_error If the ingredient or side dish pool would pass UINT32_MAX entries, the catalog is unchanged.
+     */
+    std::size_t add(const MainCourse& main_course);
+
+    /**
+     * Adds a dessert to the catalog.
+     * @param dessert A reference to the dessert to copy into the columns.
+     * @return The index of the new row.
+     * @throw std::length_error If the ingredient or side dish pool would pass UINT32_MAX entries, the catalog is unchanged.
+     */
+    std::size_t add(const Dessert& dessert);
+
+    /**
+     * Removes every row from the catalog.
+     */
+    void clear();
+
+    /**
+     * @return The number of rows in the catalog.
+     */
+    std::size_t size() const;
+
+    /**
+     * @return True if the catalog has no rows, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @param index The position of the row, must be less than size().
+     * @return A handle to the row at the given position.
+     */
+    Row operator[](std::size_t index) const;
+
+    // Column accessors, each pointer refers to size() contiguous values
+    /**
+     * @return The course column.
+     */
+    const Course* courses() const;
+
+    /**
+     * @return The price column.
+     */
+    const double* prices() const;
+
+    /**
+     * @return The preparation time column.
+     */
+    const int* prepTimes() const;
+
+    /**
+     * @return The cuisine type column.
+     */
+    const Dish::CuisineType* cuisineTypes() const;
+
+    /**
+     * @return The attribute word column (see Dish::getAttributes()), the course bits match courses(). The side
+     * dish categories of the main courses are in the bits of Dish::kSideDishCategoryMask.
+     */
+    const std::uint32_t* attributes() const;
+
+    /**
+     * @return The spiciness level column (0 for rows that are not appetizers).
+     */
+    const int* spicinessLevels() const;
+
+    /**
+     * @return The sweetness level column (0 for rows that are not desserts).
+     */
+    const int* sweetnessLevels() const;
+
+private:
+    // Appends the columns shared by every course and returns the new row index
+    std::size_t addDishColumns(const Dish& dish, Course course);
+
+    // Hot columns, one value per row
+    std::vector<Course> courses_;
+    std::vector<double> prices_;
+    std::vector<int> prep_times_;
+    std::vector<Dish::CuisineType> cuisine_types_;
+
+    // Subclass columns, one value per row (default values for rows of other courses)
+    std::vector<std::uint32_t> attributes_;    // course, cuisine, style and dietary flags
+    std::vector<int> spiciness_levels_;
+    std::vector<int> sweetness_levels_;
+
+    // Cold columns, the lists are flattened into pools addressed by offsets
+    std::vector<std::string> names_;
+    std::vector<std::string> protein_types_;
+    std::vector<std::uint32_t> ingredient_offsets_;   // size() + 1 entries
+    std::vector<SymbolTable::Id> ingredient_pool_;
+    std::vector<std::uint32_t> side_dish_offsets_;    // size() + 1 entries
+    std::vector<MainCourse::PackedSideDish> side_dish_pool_;
+};
+
+#endif // DISH_CATALOG_HPP
@@ -0,0 +1,53 @@
+/**
+ * @file DishEnums.hpp
+ * @brief This file contains the name tables of the enums of the Dish hierarchy.
+ *
+ * Every table is an EnumTable built at compile time. The names are the enumerator names, which is the text
+ * the display functions print and the text the menu feeds use. toString() and parse() are overloaded for
+ * every enum so callers do not need to name the table.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef DISH_ENUMS_HPP
+#define DISH_ENUMS_HPP
+
+#include "EnumTable.hpp"
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include <string_view>
+
+namespace DishEnums {
+
+inline constexpr EnumTable<Dish::Course, 4> kCourses({"DISH", "APPETIZER", "MAIN_COURSE", "DESSERT"});
+inline constexpr EnumTable<Dish::CuisineType, 7> kCuisineTypes({"ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"});
+inline constexpr EnumTable<Appetizer::ServingStyle, 3> kServingStyles({"PLATED", "FAMILY_STYLE", "BUFFET"});
+inline constexpr EnumTable<MainCourse::CookingMethod, 5> kCookingMethods({"GRILLED", "BAKED", "FRIED", "STEAMED", "RAW"});
+inline constexpr EnumTable<MainCourse::Category, 8> kCategories({"GRAIN", "PASTA", "LEGUME", "BREAD", "SALAD", "SOUP", "STARCHES", "VEGETABLE"});
+inline constexpr EnumTable<Dessert::FlavorProfile, 5> kFlavorProfiles({"SWEET", "BITTER", "SOUR", "SALTY", "UMAMI"});
+
+static_assert(kCourses.valid() && kCuisineTypes.valid() && kServingStyles.valid() && kCookingMethods.valid() &&
+              kCategories.valid() && kFlavorProfiles.valid(), "no perfect hash for a dish enum table");
+
+// To-string conversions, an out-of-range value gives an empty string
+constexpr std::string_view toString(Dish::Course value) { return kCourses.name(value); }
+constexpr std::string_view toString(Dish::CuisineType value) { return kCuisineTypes.name(value); }
+constexpr std::string_view toString(Appetizer::ServingStyle value) { return kServingStyles.name(value); }
+constexpr std::string_view toString(MainCourse::CookingMethod value) { return kCookingMethods.name(value); }
+constexpr std::string_view toString(MainCourse::Category value) { return kCategories.name(value); }
+constexpr std::string_view toString(Dessert::FlavorProfile value) { return kFlavorProfiles.name(value); }
+
+// Parsers, each returns false and leaves `value` unchanged if the text is not a name of the enum
+constexpr bool parse(std::string_view text, Dish::Course& value) { return kCourses.parse(text, value); }
+constexpr bool parse(std::string_view text, Dish::CuisineType& value) { return kCuisineTypes.parse(text, value); }
+constexpr bool parse(std::string_view text, Appetizer::ServingStyle& value) { return kServingStyles.parse(text, value); }
+constexpr bool parse(std::string_view text, MainCourse::CookingMethod& value) { return kCookingMethods.parse(text, value); }
+constexpr bool parse(std::string_view text, MainCourse::Category& value) { return kCategories.parse(text, value); }
+constexpr bool parse(std::string_view text, Dessert::FlavorProfile& value) { return kFlavorProfiles.parse(text, value); }
+
+} // namespace DishEnums
+
+#endif // DISH_ENUMS_HPP
@@ -0,0 +1,471 @@
+/**
+ * @file DishFilter.cpp
+ * @brief This file contains the implementation of the DishFilter predicate kernels.
+ *
+ * Every kernel fills the bitmap one 64-row word at a time. Full words are handled by the AVX2 or SSE2
+ * code path (8 or 4 int lanes, 4 or 2 double lanes, 32 or 16 byte lanes per instruction) and the last
+ * partial word by the scalar path. The AVX2 functions are compiled with a target attribute so the rest
+ * of the program does not require AVX2.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "DishFilter.hpp"
+#include <climits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define DISH_FILTER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace DishFilter {
+
+namespace {
+
+// Kernel table definition, one entry per predicate shape
+struct Kernels {
+    void (*less_than)(const double*, std::size_t, double, std::uint64_t*);
+    void (*between)(const int*, std::size_t, int, int, std::uint64_t*);
+    void (*equals)(const std::uint8_t*, std::size_t, std::uint8_t, std::uint64_t*);
+    void (*masked_equals)(const std::uint32_t*, std::size_t, std::uint32_t, std::uint32_t, std::uint64_t*);
+    void (*masked_any)(const std::uint32_t*, std::size_t, std::uint32_t, std::uint64_t*);
+};
+
+// Scalar kernels, also used for the partial word at the end of every column
+std::uint64_t lessThanWord(const double* values, std::size_t count, double limit) {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        word |= static_cast<std::uint64_t>(values[i] < limit) << i;
+    }
+    return word;
+}
+
+std::uint64_t betweenWord(const int* values, std::size_t count, int low, int high) {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        word |= static_cast<std::uint64_t>(values[i] >= low && values[i] <= high) << i;
+    }
+    return word;
+}
+
+std::uint64_t equalsWord(const std::uint8_t* values, std::size_t count, std::uint8_t key) {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        word |= static_cast<std::uint64_t>(values[i] == key) << i;
+    }
+    return word;
+}
+
+std::uint64_t maskedEqualsWord(const std::uint32_t* values, std::size_t count, std::uint32_t mask, std::uint32_t key) {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        word |= static_cast<std::uint64_t>((values[i] & mask) == key) << i;
+    }
+    return word;
+}
+
+std::uint64_t maskedAnyWord(const std::uint32_t* values, std::size_t count, std::uint32_t mask) {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        word |= static_cast<std::uint64_t>((values[i] & mask) != 0) << i;
+    }
+    return word;
+}
+
+void lessThanScalar(const double* values, std::size_t count, double limit, std::uint64_t* out) {
+    for (std::size_t base = 0; base < count; base += 64) {
+        std::size_t n = count - base < 64 ? count - base : 64;
+        out[base / 64] = lessThanWord(values + base, n, limit);
+    }
+}
+
+void betweenScalar(const int* values, std::size_t count, int low, int high, std::uint64_t* out) {
+    for (std::size_t base = 0; base < count; base += 64) {
+        std::size_t n = count - base < 64 ? count - base : 64;
+        out[base / 64] = betweenWord(values + base, n, low, high);
+    }
+}
+
+void equalsScalar(const std::uint8_t* values, std::size_t count, std::uint8_t key, std::uint64_t* out) {
+    for (std::size_t base = 0; base < count; base += 64) {
+        std::size_t n = count - base < 64 ? count - base : 64;
+        out[base / 64] = equalsWord(values + base, n, key);
+    }
+}
+
+void maskedEqualsScalar(const std::uint32_t* values, std::size_t count, std::uint32_t mask, std::uint32_t key, std::uint64_t* out) {
+    for (std::size_t base = 0; base < count; base += 64) {
+        std::size_t n = count - base < 64 ? count - base : 64;
+        out[base / 64] = maskedEqualsWord(values + base, n, mask, key);
+    }
+}
+
+void maskedAnyScalar(const std::uint32_t* values, std::size_t count, std::uint32_t mask, std::uint64_t* out) {
+    for (std::size_t base = 0; base < count; base += 64) {
+        std::size_t n = count - base < 64 ? count - base : 64;
+        out[base / 64] = maskedAnyWord(values + base, n, mask);
+    }
+}
+
+#ifdef DISH_FILTER_X86
+// SSE2 kernels
+void lessThanSse2(const double* values, std::size_t count, double limit, std::uint64_t* out) {
+    const __m128d limits = _mm_set1_pd(limit);
+    std::size_t base = 0;
+    for (; base + 64 <= count; base += 64) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < 64; i += 2) {
+            __m128d lanes = _mm_loadu_pd(values + base + i);
+            word |= static_cast<std::uint64_t>(_mm_movemask_pd(_mm_cmplt_pd(lanes, limits))) << i;
+        }
+        out[base / 64] = word;
+    }
+    if (base < count) {
+        out[base / 64] = lessThanWord(values + base, count - base, limit);
+    }
+}
+
+void betweenSse2(const int* values, std::size_t count, int low, int high, std::uint64_t* out) {
+    const __m128i lows = _mm_set1_epi32(low);
+    const __m128i highs = _mm_set1_epi32(high);
+    std::size_t base = 0;
+    for (; base + 64 <= count; base += 64) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < 64; i += 4) {
+            __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + base + i));
+            __m128i outside = _mm_or_si128(_mm_cmpgt_epi32(lows, lanes), _mm_cmpgt_epi32(lanes, highs));
+            std::uint64_t bits = ~static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(outside))) & 0xFu;
+            word |= bits << i;
+        }
+        out[base / 64] = word;
+    }
+    if (base < count) {
+        out[base / 64] = betweenWord(values + base, count - base, low, high);
+    }
+}
+
+void equalsSse2(const std::uint8_t* values, std::size_t count, std::uint8_t key, std::uint64_t* out) {
+    const __m128i keys = _mm_set1_epi8(static_cast<char>(key));
+    std::size_t base = 0;
+    for (; base + 64 <= count; base += 64) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < 64; i += 16) {
+            __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + base + i));
+            std::uint64_t bits = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(lanes, keys)));
+            word |= bits << i;
+        }
+        out[base / 64] = word;
+    }
+    if (base < count) {
+        out[base / 64] = equalsWord(values + base, count - base, key);
+    }
+}
+
+void maskedEqualsSse2(const std::uint32_t* values, std::size_t count, std::uint32_t mask, std::uint32_t key, std::uint64_t* out) {
+    const __m128i masks = _mm_set1_epi32(static_cast<int>(mask));
+    const __m128i keys = _mm_set1_epi32(static_cast<int>(key));
+    std::size_t base = 0;
+    for (; base + 64 <= count; base += 64) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < 64; i += 4) {
+            __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + base + i));
+            __m128i equal = _mm_cmpeq_epi32(_mm_and_si128(lanes, masks), keys);
+            word |= static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(equal))) << i;
+        }
+        out[base / 64] = word;
+    }
+    if (base < count) {
+        out[base / 64] = maskedEqualsWord(values + base, count - base, mask, key);
+    }
+}
+
+// Compares the masked lanes with zero and inverts the lane mask
+void maskedAnySse2(const std::uint32_t* values, std::size_t count, std::uint32_t mask, std::uint64_t* out) {
+    const __m128i masks = _mm_set1_epi32(static_cast<int>(mask));
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t base = 0;
+    for (; base + 64 <= count; base += 64) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < 64; i += 4) {
+            __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + base + i));
+            __m128i none = _mm_cmpeq_epi32(_mm_and_si128(lanes, masks), zero);
+            word |= static_cast<std::uint64_t>(~_mm_movemask_ps(_mm_castsi128_ps(none)) & 0xF) << i;
+        }
+        out[base / 64] = word;
+    }
+    if (base < count) {
+        out[base / 64] = maskedAnyWord(values + base, count - base, mask);
+    }
+}
+
+// AVX2 kernels
+__attribute__((target("avx2")))
+void lessThanAvx2(const double* values, std::size_t count, double limit, std::uint64_t* out) {
+    const __m256d limits = _mm256_set1_pd(limit);
+    std::size_t base = 0;
+    for (; base + 64 <= count; base += 64) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < 64; i += 4) {
+            __m256d lanes = _mm256_loadu_pd(values + base + i);
+            word |= static_cast<std::uint64_t>(_mm256_movemask_pd(_mm256_cmp_pd(lanes, limits, _CMP_LT_OQ))) << i;
+        }
+        out[base / 64] = word;
+    }
+    if (base < count) {
+        out[base / 64] = lessThanWord(values + base, count - base, limit);
+    }
+}
+
+__attribute__((target("avx2")))
+void betweenAvx2(const int* values, std::size_t count, int low, int high, std::uint64_t* out) {
+    const __m256i lows = _mm256_set1_epi32(low);
+    const __m256i highs = _mm256_set1_epi32(high);
+    std::size_t base = 0;
+    for (; base + 64 <= count; base += 64) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < 64; i += 8) {
+            __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + base + i));
+            __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi32(lows, lanes), _mm256_cmpgt_epi32(lanes, highs));
+            std::uint64_t bits = ~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(outside))) & 0xFFu;
+            word |= bits << i;
+        }
+        out[base / 64] = word;
+    }
+    if (base < count) {
+        out[base / 64] = betweenWord(values + base, count - base, low, high);
+    }
+}
+
+__attribute__((target("avx2")))
+void equalsAvx2(const std::uint8_t* values, std::size_t count, std::uint8_t key, std::uint64_t* out) {
+    const __m256i keys = _mm256_set1_epi8(static_cast<char>(key));
+    std::size_t base = 0;
+    for (; base + 64 <= count; base += 64) {
+        __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + base));
+        __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + base + 32));
+        std::uint64_t low_bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, keys)));
+        std::uint64_t high_bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, keys)));
+        out[base / 64] = low_bits | (high_bits << 32);
+    }
+    if (base < count) {
+        out[base / 64] = equalsWord(values + base, count - base, key);
+    }
+}
+__attribute__((target("avx2")))
+void maskedEqualsAvx2(const std::uint32_t* values, std::size_t count, std::uint32_t mask, std::uint32_t key, std::uint64_t* out) {
+    const __m256i masks = _mm256_set1_epi32(static_cast<int>(mask));
+    const __m256i keys = _mm256_set1_epi32(static_cast<int>(key));
+    std::size_t base = 0;
+    for (; base + 64 <= count; base += 64) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < 64; i += 8) {
+            __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + base + i));
+            __m256i equal = _mm256_cmpeq_epi32(_mm256_and_si256(lanes, masks), keys);
+            word |= static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(equal))) << i;
+        }
+        out[base / 64] = word;
+    }
+    if (base < count) {
+        out[base / 64] = maskedEqualsWord(values + base, count - base, mask, key);
+    }
+}
+__attribute__((target("avx2")))
+void maskedAnyAvx2(const std::uint32_t* values, std::size_t count, std::uint32_t mask, std::uint64_t* out) {
+    const __m256i masks = _mm256_set1_epi32(static_cast<int>(mask));
+    const __m256i zero = _mm256_setzero_si256();
+    std::size_t base = 0;
+    for (; base + 64 <= count; base += 64) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < 64; i += 8) {
+            __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + base + i));
+            __m256i none = _mm256_cmpeq_epi32(_mm256_and_si256(lanes, masks), zero);
+            word |= static_cast<std::uint64_t>(~_mm256_movemask_ps(_mm256_castsi256_ps(none)) & 0xFF) << i;
+        }
+        out[base / 64] = word;
+    }
+    if (base < count) {
+        out[base / 64] = maskedAnyWord(values + base, count - base, mask);
+    }
+}
+#endif // DISH_FILTER_X86
+
+const Kernels kScalarKernels = {lessThanScalar, betweenScalar, equalsScalar, maskedEqualsScalar, maskedAnyScalar};
+#ifdef DISH_FILTER_X86
+const Kernels kSse2Kernels = {lessThanSse2, betweenSse2, equalsSse2, maskedEqualsSse2, maskedAnySse2};
+const Kernels kAvx2Kernels = {lessThanAvx2, betweenAvx2, equalsAvx2, maskedEqualsAvx2, maskedAnyAvx2};
+#endif
+
+// Returns the best instruction set the CPU supports
+Isa detectIsa() {
+#ifdef DISH_FILTER_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return Isa::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return Isa::SSE2;
+    }
+#endif
+    return Isa::SCALAR;
+}
+
+const Kernels& kernelsFor(Isa isa) {
+    switch (isa) {
+#ifdef DISH_FILTER_X86
+        case Isa::AVX2: return kAvx2Kernels;
+        case Isa::SSE2: return kSse2Kernels;
+#endif
+        default: return kScalarKernels;
+    }
+}
+
+// The selected instruction set, resolved from CPUID on first use
+Isa& currentIsa() {
+    static Isa isa = detectIsa();
+    return isa;
+}
+
+const Kernels& kernels() {
+    return kernelsFor(currentIsa());
+}
+
+} // namespace
+
+// Instruction Set Functions
+Isa activeIsa() {
+    return currentIsa();
+}
+
+Isa setIsa(Isa isa) {
+    Isa supported = detectIsa();
+    currentIsa() = static_cast<int>(isa) < static_cast<int>(supported) ? isa : supported;
+    return currentIsa();
+}
+
+const char* isaName(Isa isa) {
+    switch (isa) {
+        case Isa::AVX2: return "AVX2";
+        case Isa::SSE2: return "SSE2";
+        default: return "SCALAR";
+    }
+}
+
+std::size_t bitmapWords(std::size_t rows) {
+    return (rows + 63) / 64;
+}
+
+// Raw Column Kernels
+void priceLessThan(const double* prices, std::size_t count, double max_price, std::uint64_t* out) {
+    kernels().less_than(prices, count, max_price, out);
+}
+
+void prepTimeAtMost(const int* prep_times, std::size_t count, int max_prep_time, std::uint64_t* out) {
+    kernels().between(prep_times, count, INT_MIN, max_prep_time, out);
+}
+
+void levelAtLeast(const int* levels, std::size_t count, int min_level, std::uint64_t* out) {
+    kernels().between(levels, count, min_level, INT_MAX, out);
+}
+
+void levelBetween(const int* levels, std::size_t count, int min_level, int max_level, std::uint64_t* out) {
+    kernels().between(levels, count, min_level, max_level, out);
+}
+
+void courseIs(const DishCatalog::Course* courses, std::size_t count, DishCatalog::Course course, std::uint64_t* out) {
+    kernels().equals(reinterpret_cast<const std::uint8_t*>(courses), count, static_cast<std::uint8_t>(course), out);
+}
+
+void attributesMatch(const std::uint32_t* attributes, std::size_t count, std::uint32_t mask, std::uint32_t value, std::uint64_t* out) {
+    kernels().masked_equals(attributes, count, mask, value & mask, out);
+}
+
+void attributesAny(const std::uint32_t* attributes, std::size_t count, std::uint32_t mask, std::uint64_t* out) {
+    kernels().masked_any(attributes, count, mask, out);
+}
+
+// Catalog Kernels
+Bitmap priceLessThan(const DishCatalog& catalog, double max_price) {
+    Bitmap bitmap(bitmapWords(catalog.size()));
+    priceLessThan(catalog.prices(), catalog.size(), max_price, bitmap.data());
+    return bitmap;
+}
+
+Bitmap prepTimeAtMost(const DishCatalog& catalog, int max_prep_time) {
+    Bitmap bitmap(bitmapWords(catalog.size()));
+    prepTimeAtMost(catalog.prepTimes(), catalog.size(), max_prep_time, bitmap.data());
+    return bitmap;
+}
+
+Bitmap spicinessAtLeast(const DishCatalog& catalog, int min_level) {
+    Bitmap bitmap(bitmapWords(catalog.size()));
+    levelAtLeast(catalog.spicinessLevels(), catalog.size(), min_level, bitmap.data());
+    intersect(bitmap, courseIs(catalog, DishCatalog::Course::APPETIZER));
+    return bitmap;
+}
+
+Bitmap sweetnessBetween(const DishCatalog& catalog, int min_level, int max_level) {
+    Bitmap bitmap(bitmapWords(catalog.size()));
+    levelBetween(catalog.sweetnessLevels(), catalog.size(), min_level, max_level, bitmap.data());
+    intersect(bitmap, courseIs(catalog, DishCatalog::Course::DESSERT));
+    return bitmap;
+}
+
+Bitmap courseIs(const DishCatalog& catalog, DishCatalog::Course course) {
+    Bitmap bitmap(bitmapWords(catalog.size()));
+    courseIs(catalog.courses(), catalog.size(), course, bitmap.data());
+    return bitmap;
+}
+
+Bitmap attributesMatch(const DishCatalog& catalog, const AttributeFilter& filter) {
+    Bitmap bitmap(bitmapWords(catalog.size()));
+    attributesMatch(catalog.attributes(), catalog.size(), filter.mask(), filter.value(), bitmap.data());
+    return bitmap;
+}
+
+Bitmap sideDishCategoryAny(const DishCatalog& catalog, std::uint32_t categories) {
+    // Only main courses have side dish bits, so the course needs no separate test
+    Bitmap bitmap(bitmapWords(catalog.size()));
+    attributesAny(catalog.attributes(), catalog.size(), (categories << Dish::kSideDishCategoryShift) & Dish::kSideDishCategoryMask,
+                  bitmap.data());
+    return bitmap;
+}
+
+// Bitmap Helpers
+void intersect(Bitmap& target, const Bitmap& other) {
+    for (std::size_t i = 0; i < target.size(); ++i) {
+        target[i] &= i < other.size() ? other[i] : 0;
+    }
+}
+
+void unite(Bitmap& target, const Bitmap& other) {
+    if (target.size() < other.size()) {
+        target.resize(other.size(), 0);
+    }
+    for (std::size_t i = 0; i < other.size(); ++i) {
+        target[i] |= other[i];
+    }
+}
+
+std::size_t count(const Bitmap& bitmap) {
+    std::size_t total = 0;
+    for (std::uint64_t word : bitmap) {
+        total += static_cast<std::size_t>(__builtin_popcountll(word));
+    }
+    return total;
+}
+
+std::vector<std::uint32_t> toIndexList(const Bitmap& bitmap) {
+    std::vector<std::uint32_t> indexes;
+    indexes.reserve(count(bitmap));
+    for (std::size_t w = 0; w < bitmap.size(); ++w) {
+        std::uint64_t word = bitmap[w];
+        while (word != 0) {
+            indexes.push_back(static_cast<std::uint32_t>(w * 64 + __builtin_ctzll(word)));
+            word &= word - 1;
+        }
+    }
+    return indexes;
+}
+
+} // namespace DishFilter
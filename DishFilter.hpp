@@ -0,0 +1,159 @@
+/**
+ * @file DishFilter.hpp
+ * @brief This file contains the declaration of the DishFilter predicate kernels used to filter DishCatalog columns.
+ *
+ * Each kernel compares one contiguous column against a constant and writes a selection bitmap, one bit per
+ * row (bit i % 64 of word i / 64). The kernels are vectorized with AVX2 or SSE2 when the CPU supports them
+ * and fall back to a scalar loop otherwise. The instruction set is picked at runtime from CPUID.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef DISH_FILTER_HPP
+#define DISH_FILTER_HPP
+
+#include "AttributeFilter.hpp"
+#include "DishCatalog.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace DishFilter {
+
+// Isa enum definition, the instruction sets the kernels can run with
+enum class Isa { SCALAR, SSE2, AVX2 };
+
+// A selection bitmap, bit i is set if row i passed the filter
+using Bitmap = std::vector<std::uint64_t>;
+
+/**
+ * @return The instruction set currently used by the kernels.
+ */
+Isa activeIsa();
+
+/**
+ * Forces the kernels to use an instruction set.
+ * @param isa The requested instruction set.
+ * @return The instruction set actually used, the request is lowered to the best set the CPU supports.
+ */
+Isa setIsa(Isa isa);
+
+/**
+ * @return The name of the instruction set in string form.
+ */
+const char* isaName(Isa isa);
+
+/**
+ * @param rows The number of rows.
+ * @return The number of 64-bit words a bitmap over the given number of rows needs.
+ */
+std::size_t bitmapWords(std::size_t rows);
+
+// Raw column kernels, `out` must hold bitmapWords(count) words
+/**
+ * Selects the rows whose price is less than a limit.
+ * @post Bit i of `out` is set if prices[i] < max_price. Bits past `count` are cleared.
+ */
+void priceLessThan(const double* prices, std::size_t count, double max_price, std::uint64_t* out);
+
+/**
+ * Selects the rows whose preparation time is at most a limit.
+ * @post Bit i of `out` is set if prep_times[i] <= max_prep_time. Bits past `count` are cleared.
+ */
+void prepTimeAtMost(const int* prep_times, std::size_t count, int max_prep_time, std::uint64_t* out);
+
+/**
+ * Selects the rows whose level (spiciness, sweetness) is at least a minimum.
+ * @post Bit i of `out` is set if levels[i] >= min_level. Bits past `count` are cleared.
+ */
+void levelAtLeast(const int* levels, std::size_t count, int min_level, std::uint64_t* out);
+
+/**
+ * Selects the rows whose level (spiciness, sweetness) lies in a closed range.
+ * @post Bit i of `out` is set if min_level <= levels[i] <= max_level. Bits past `count` are cleared.
+ */
+void levelBetween(const int* levels, std::size_t count, int min_level, int max_level, std::uint64_t* out);
+
+/**
+ * Selects the rows of one course.
+ * @post Bit i of `out` is set if courses[i] == course. Bits past `count` are cleared.
+ */
+void courseIs(const DishCatalog::Course* courses, std::size_t count, DishCatalog::Course course, std::uint64_t* out);
+
+/**
+ * Selects the rows whose attribute word has some bits set to a value (see AttributeFilter).
+ * @post Bit i of `out` is set if (attributes[i] & mask) == (value & mask). Bits past `count` are cleared.
+ */
+void attributesMatch(const std::uint32_t* attributes, std::size_t count, std::uint32_t mask, std::uint32_t value, std::uint64_t* out);
+
+/**
+ * Selects the rows whose attribute word has at least one of some bits set.
+ * @post Bit i of `out` is set if (attributes[i] & mask) != 0. Bits past `count` are cleared.
+ */
+void attributesAny(const std::uint32_t* attributes, std::size_t count, std::uint32_t mask, std::uint64_t* out);
+
+// Catalog kernels, each returns a bitmap over every row of the catalog
+/**
+ * @return The rows whose price is less than max_price.
+ */
+Bitmap priceLessThan(const DishCatalog& catalog, double max_price);
+
+/**
+ * @return The rows whose preparation time is at most max_prep_time.
+ */
+Bitmap prepTimeAtMost(const DishCatalog& catalog, int max_prep_time);
+
+/**
+ * @return The appetizers whose spiciness level is at least min_level.
+ */
+Bitmap spicinessAtLeast(const DishCatalog& catalog, int min_level);
+
+/**
+ * @return The desserts whose sweetness level lies between min_level and max_level (inclusive).
+ */
+Bitmap sweetnessBetween(const DishCatalog& catalog, int min_level, int max_level);
+
+/**
+ * @return The rows of the given course.
+ */
+Bitmap courseIs(const DishCatalog& catalog, DishCatalog::Course course);
+
+/**
+ * @return The rows whose attribute word passes the filter, of any course.
+ */
+Bitmap attributesMatch(const DishCatalog& catalog, const AttributeFilter& filter);
+
+/**
+ * @param categories The side dish categories, one bit per category (see MainCourse::sideDishCategoryBit()).
+ * @return The main courses served with at least one side dish of the categories, found from the attribute
+ * column alone.
+ */
+Bitmap sideDishCategoryAny(const DishCatalog& catalog, std::uint32_t categories);
+
+// Bitmap helpers
+/**
+ * Intersects two bitmaps.
+ * @post `target` holds the rows selected by both `target` and `other`.
+ */
+void intersect(Bitmap& target, const Bitmap& other);
+
+/**
+ * Unites two bitmaps.
+ * @post `target` holds the rows selected by `target` or `other`.
+ */
+void unite(Bitmap& target, const Bitmap& other);
+
+/**
+ * @return The number of rows selected by the bitmap.
+ */
+std::size_t count(const Bitmap& bitmap);
+
+/**
+ * @return The indexes of the rows selected by the bitmap, in increasing order.
+ */
+std::vector<std::uint32_t> toIndexList(const Bitmap& bitmap);
+
+} // namespace DishFilter
+
+#endif // DISH_FILTER_HPP
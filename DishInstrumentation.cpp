@@ -0,0 +1,155 @@
+/**
+ * @file DishInstrumentation.cpp
+ * @brief This file contains the implementation of the DishInstrumentation counters.
+ *
+ * A thread registers its counter block the first time it counts and, when it exits, adds the block to the
+ * counts of exited threads and unregisters it. Only the owning thread writes a block, with relaxed loads
+ * and stores, so collect() can read it at any time without tearing a value.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "DishInstrumentation.hpp"
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <mutex>
+
+namespace DishInstrumentation {
+
+namespace {
+
+const std::string_view kSubjectNames[kSubjectCount] = {
+    "Dish", "Appetizer", "MainCourse", "Dessert", "SideDish",
+    "getName", "getIngredients", "getCuisineType", "getProteinType", "getSideDishes"
+};
+
+const std::string_view kCounterNames[kCounterCount] = {"constructions", "copies", "moves", "calls", "allocations", "bytes"};
+
+// The counters of one thread, on cache lines of their own
+struct alignas(64) Block {
+    std::atomic<std::uint64_t> values[kSubjectCount][kCounterCount];
+
+    Block() {
+        for (auto& row : values) {
+            for (std::atomic<std::uint64_t>& value : row) {
+                value.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<Block*> blocks;     // of the running threads
+    Totals exited;                  // counts of the threads that have exited
+};
+
+Registry& registry() {
+    static Registry* registry = new Registry();  // Never destroyed, threads may exit after static destructors run
+    return *registry;
+}
+
+// Registers the block of the calling thread on first use and folds it into the totals when the thread exits
+struct ThreadBlock {
+    Block* block = nullptr;
+
+    Block& get() {
+        if (block == nullptr) {
+            block = new Block();
+            Registry& shared = registry();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            shared.blocks.push_back(block);
+        }
+        return *block;
+    }
+
+    ~ThreadBlock() {
+        if (block == nullptr) {
+            return;
+        }
+        Registry& shared = registry();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        for (std::size_t s = 0; s < kSubjectCount; ++s) {
+            for (std::size_t c = 0; c < kCounterCount; ++c) {
+                shared.exited.values[s][c] += block->values[s][c].load(std::memory_order_relaxed);
+            }
+        }
+        shared.blocks.erase(std::find(shared.blocks.begin(), shared.blocks.end(), block));
+        delete block;
+    }
+};
+
+thread_local ThreadBlock t_block;
+
+} // namespace
+
+// Counting Functions
+void add(Subject subject, Counter counter, std::uint64_t amount) {
+    std::atomic<std::uint64_t>& value = t_block.get().values[static_cast<std::size_t>(subject)][static_cast<std::size_t>(counter)];
+    value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+Totals collect() {
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    Totals totals = shared.exited;
+    for (const Block* block : shared.blocks) {
+        for (std::size_t s = 0; s < kSubjectCount; ++s) {
+            for (std::size_t c = 0; c < kCounterCount; ++c) {
+                totals.values[s][c] += block->values[s][c].load(std::memory_order_relaxed);
+            }
+        }
+    }
+    return totals;
+}
+
+void reset() {
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    shared.exited = Totals();
+    for (Block* block : shared.blocks) {
+        for (auto& row : block->values) {
+            for (std::atomic<std::uint64_t>& value : row) {
+                value.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+// Report Functions
+void report(std::ostream& out) {
+    if (!enabled()) {
+        out << "Dish instrumentation is off (build with make INSTRUMENT=1)" << std::endl;
+        return;
+    }
+    Totals totals = collect();
+    out << std::left << std::setw(16) << "subject" << std::right;
+    for (std::string_view name : kCounterNames) {
+        out << std::setw(14) << name;
+    }
+    out << '\n';
+    for (std::size_t s = 0; s < kSubjectCount; ++s) {
+        const std::uint64_t* row = totals.values[s];
+        if (std::all_of(row, row + kCounterCount, [](std::uint64_t value) { return value == 0; })) {
+            continue;
+        }
+        out << std::left << std::setw(16) << kSubjectNames[s] << std::right;
+        for (std::size_t c = 0; c < kCounterCount; ++c) {
+            out << std::setw(14) << row[c];
+        }
+        out << '\n';
+    }
+    out.flush();
+}
+
+std::string_view subjectName(Subject subject) {
+    return kSubjectNames[static_cast<std::size_t>(subject)];
+}
+
+std::string_view counterName(Counter counter) {
+    return kCounterNames[static_cast<std::size_t>(counter)];
+}
+
+} // namespace DishInstrumentation
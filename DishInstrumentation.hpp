@@ -0,0 +1,156 @@
+/**
+ * @file DishInstrumentation.hpp
+ * @brief This file contains the DishInstrumentation counters of constructions, copies, moves and heap allocations of the Dish classes.
+ *
+ * The counters are compiled in only when DISH_INSTRUMENTATION is defined to 1 for every file of the program
+ * (make INSTRUMENT=1); otherwise the DISH_COUNT macros expand to nothing and the Dish classes are exactly
+ * what they are without them. Counters are kept per subject: the four classes, the side dishes of main
+ * courses and the accessors that return their result by value.
+ *
+ * The Dish counters cover the Dish part of every class, so copying a MainCourse counts one Dish copy and
+ * one MainCourse copy, and the heap blocks of the name and ingredients are counted under Dish. Heap
+ * allocations are derived from the buffers a construction, copy or accessor leaves behind (a string that
+ * outgrew its inline buffer, a vector with capacity), which is exact for those operations; assignments
+ * reuse buffers and are counted as copies or moves only.
+ *
+ * Every thread counts into its own cache-line-aligned block without atomic read-modify-write operations.
+ * collect() adds up the blocks of the running threads and the counts of the threads that have exited.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef DISH_INSTRUMENTATION_HPP
+#define DISH_INSTRUMENTATION_HPP
+
+#include "SmallVector.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#ifndef DISH_INSTRUMENTATION
+#define DISH_INSTRUMENTATION 0
+#endif
+
+namespace DishInstrumentation {
+
+// Subject enum definition, what a count is about
+enum class Subject : std::uint8_t {
+    DISH, APPETIZER, MAIN_COURSE, DESSERT, SIDE_DISH,
+    GET_NAME, GET_INGREDIENTS, GET_CUISINE_TYPE, GET_PROTEIN_TYPE, GET_SIDE_DISHES
+};
+constexpr std::size_t kSubjectCount = 10;
+
+// Counter enum definition, what is counted
+enum class Counter : std::uint8_t { CONSTRUCTIONS, COPIES, MOVES, CALLS, ALLOCATIONS, BYTES };
+constexpr std::size_t kCounterCount = 6;
+
+// Totals definition, the sum of every thread's counters
+struct Totals {
+    std::uint64_t values[kSubjectCount][kCounterCount] = {};
+
+    /**
+     * @return The count of one counter of one subject.
+     */
+    std::uint64_t get(Subject subject, Counter counter) const {
+        return values[static_cast<std::size_t>(subject)][static_cast<std::size_t>(counter)];
+    }
+};
+
+/**
+ * @return True if the program was built with DISH_INSTRUMENTATION, false otherwise.
+ */
+constexpr bool enabled() {
+    return DISH_INSTRUMENTATION != 0;
+}
+
+/**
+ * Adds to a counter of the calling thread. Use the DISH_COUNT macros, which compile to nothing when the
+ * instrumentation is off.
+ */
+void add(Subject subject, Counter counter, std::uint64_t amount);
+
+/**
+ * @return The counters of every thread, all zero when the instrumentation is off.
+ */
+Totals collect();
+
+/**
+ * Sets every counter to zero. Counts made by other threads at the same time may survive.
+ */
+void reset();
+
+/**
+ * Prints the non-zero counters, one line per subject.
+ * @param out The stream to print to.
+ */
+void report(std::ostream& out);
+
+/**
+ * @return The name of a subject, e.g. "MainCourse" or "getIngredients".
+ */
+std::string_view subjectName(Subject subject);
+
+/**
+ * @return The name of a counter, e.g. "copies".
+ */
+std::string_view counterName(Counter counter);
+
+/**
+ * @return The heap bytes a string holds, 0 while it fits in its inline buffer.
+ */
+template <typename String>
+std::size_t heapBytes(const String& text) {
+    const char* data = text.data();
+    const char* object = reinterpret_cast<const char*>(&text);
+    bool inline_buffer = data >= object && data < object + sizeof(text);
+    return inline_buffer ? 0 : (text.capacity() + 1) * sizeof(*data);
+}
+
+/**
+ * @return The heap bytes a vector holds, not counting what its elements hold.
+ */
+template <typename T, typename Allocator>
+std::size_t heapBytes(const std::vector<T, Allocator>& values) {
+    return values.capacity() * sizeof(T);
+}
+
+/**
+ * @return The heap bytes a SmallVector holds, 0 while its elements are inline.
+ */
+template <typename T, std::size_t N>
+std::size_t heapBytes(const SmallVector<T, N>& values) {
+    return values.isInline() ? 0 : values.capacity() * sizeof(T);
+}
+
+/**
+ * Counts the heap block of a string or vector, if it has one.
+ */
+template <typename Container>
+void addHeap(Subject subject, const Container& container) {
+    std::size_t bytes = heapBytes(container);
+    if (bytes != 0) {
+        add(subject, Counter::ALLOCATIONS, 1);
+        add(subject, Counter::BYTES, bytes);
+    }
+}
+
+} // namespace DishInstrumentation
+
+#if DISH_INSTRUMENTATION
+#define DISH_COUNT(subject, counter) \
+    DishInstrumentation::add(DishInstrumentation::Subject::subject, DishInstrumentation::Counter::counter, 1)
+#define DISH_COUNT_N(subject, counter, amount) \
+    DishInstrumentation::add(DishInstrumentation::Subject::subject, DishInstrumentation::Counter::counter, (amount))
+#define DISH_COUNT_HEAP(subject, container) \
+    DishInstrumentation::addHeap(DishInstrumentation::Subject::subject, (container))
+#else
+// The arguments stay unevaluated, sizeof only keeps loop variables used by the counts from being reported as unused
+#define DISH_COUNT(subject, counter) ((void)0)
+#define DISH_COUNT_N(subject, counter, amount) ((void)sizeof(amount))
+#define DISH_COUNT_HEAP(subject, container) ((void)sizeof(container))
+#endif
+
+#endif // DISH_INSTRUMENTATION_HPP
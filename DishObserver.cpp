@@ -0,0 +1,59 @@
+/**
+ * @file DishObserver.cpp
+ * @brief This file contains the implementation of the DishObserver interface and the DishObserverList class.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "DishObserver.hpp"
+#include <algorithm>
+
+// Default Notifications, which do nothing
+DishObserver::~DishObserver() {
+}
+
+void DishObserver::dishChanging(const Dish&, Field) {
+}
+
+void DishObserver::dishChanged(const Dish&, Field) {
+}
+
+void DishObserver::dishMoved(const Dish&, const Dish&) noexcept {
+}
+
+void DishObserver::dishDestroyed(const Dish&) {
+}
+
+// Observer List Functions
+void DishObserverList::add(DishObserver& observer) {
+    observers_.push_back(&observer);
+}
+
+void DishObserverList::remove(DishObserver& observer) {
+    observers_.erase(std::remove(observers_.begin(), observers_.end(), &observer), observers_.end());
+}
+
+void DishObserverList::dishChanging(const Dish& dish, Field field) {
+    for (DishObserver* observer : observers_) {
+        observer->dishChanging(dish, field);
+    }
+}
+
+void DishObserverList::dishChanged(const Dish& dish, Field field) {
+    for (DishObserver* observer : observers_) {
+        observer->dishChanged(dish, field);
+    }
+}
+
+void DishObserverList::dishMoved(const Dish& from, const Dish& to) noexcept {
+    for (DishObserver* observer : observers_) {
+        observer->dishMoved(from, to);
+    }
+}
+
+void DishObserverList::dishDestroyed(const Dish& dish) {
+    for (DishObserver* observer : observers_) {
+        observer->dishDestroyed(dish);
+    }
+}
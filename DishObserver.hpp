@@ -0,0 +1,90 @@
+/**
+ * @file DishObserver.hpp
+ * @brief This file contains the declaration of the DishObserver interface and the DishObserverList class.
+ *
+ * A dish can have one observer, set with Dish::setObserver(). The observer is told before and after every
+ * change made through a setter or an assignment, when the dish is moved to a new address and when it is
+ * destroyed, which lets indexes and aggregates built over a set of dishes stay up to date without rescanning.
+ * Several observers can watch the same dishes through a DishObserverList.
+ *
+ * The field of a change tells which class the dish is: SERVING_STYLE, SPICINESS_LEVEL and VEGETARIAN are only
+ * reported for an Appetizer, COOKING_METHOD, PROTEIN_TYPE, SIDE_DISHES and GLUTEN_FREE for a MainCourse, and
+ * FLAVOR_PROFILE, SWEETNESS_LEVEL and CONTAINS_NUTS for a Dessert. ALL is reported for assignments.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef DISH_OBSERVER_HPP
+#define DISH_OBSERVER_HPP
+
+#include <vector>
+
+class Dish;
+
+class DishObserver {
+public:
+    // Field enum definition, the part of a dish a change touches
+    enum class Field {
+        ALL,
+        NAME, INGREDIENTS, PREP_TIME, PRICE, CUISINE_TYPE,
+        SERVING_STYLE, SPICINESS_LEVEL, VEGETARIAN,
+        COOKING_METHOD, PROTEIN_TYPE, SIDE_DISHES, GLUTEN_FREE,
+        FLAVOR_PROFILE, SWEETNESS_LEVEL, CONTAINS_NUTS
+    };
+
+    virtual ~DishObserver();
+
+    /**
+     * Called before a field of the dish changes, while it still holds the old value.
+     * @param dish A reference to the dish.
+     * @param field The field about to change.
+     */
+    virtual void dishChanging(const Dish& dish, Field field);
+
+    /**
+     * Called after a field of the dish changed.
+     * @param dish A reference to the dish.
+     * @param field The field that changed.
+     */
+    virtual void dishChanged(const Dish& dish, Field field);
+
+    /**
+     * Called when a dish is move-constructed to a new address; the observer moves with it. Called from the
+     * Dish move constructor, so the members of derived classes of `to` are not moved yet, and it must not throw.
+     * @param from A reference to the dish that was observed.
+     * @param to A reference to the dish that is observed from now on.
+     */
+    virtual void dishMoved(const Dish& from, const Dish& to) noexcept;
+
+    /**
+     * Called from the Dish destructor, after the members of derived classes are destroyed.
+     * @param dish A reference to the dish, only its Dish members may be used.
+     */
+    virtual void dishDestroyed(const Dish& dish);
+};
+
+class DishObserverList : public DishObserver {
+public:
+    /**
+     * Adds an observer; observers are notified in the order they were added.
+     * @param observer A reference to the observer, which must outlive the list or be removed first.
+     */
+    void add(DishObserver& observer);
+
+    /**
+     * Removes an observer.
+     * @param observer A reference to the observer.
+     */
+    void remove(DishObserver& observer);
+
+    void dishChanging(const Dish& dish, Field field) override;
+    void dishChanged(const Dish& dish, Field field) override;
+    void dishMoved(const Dish& from, const Dish& to) noexcept override;
+    void dishDestroyed(const Dish& dish) override;
+
+private:
+    std::vector<DishObserver*> observers_;
+};
+
+#endif // DISH_OBSERVER_HPP
@@ -0,0 +1,124 @@
+/**
+ * @file EnumTable.hpp
+ * @brief This file contains the EnumTable class template, a compile-time name table for an enum with values 0 to N - 1.
+ *
+ * The names are stored in value order, so converting a value to its name is an array index. Parsing a name
+ * uses a perfect hash: the constructor searches for a seed under which the seeded FNV-1a hash of every name
+ * lands in its own slot of a small power-of-two table, so a lookup is one hash over the text, one slot
+ * read and one string comparison, whatever the number of names. Tables are built as constexpr variables;
+ * a seed that cannot be found makes valid() false, which the tables check with a static_assert.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef ENUM_TABLE_HPP
+#define ENUM_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+template <typename Enum, std::size_t N>
+class EnumTable {
+public:
+    /**
+     * Constructor.
+     * @param names The name of every value, in value order. The names must be distinct.
+     */
+    constexpr EnumTable(const std::string_view (&names)[N]) : names_{}, slots_{}, seed_(0), valid_(false) {
+        for (std::size_t i = 0; i < N; ++i) {
+            names_[i] = names[i];
+        }
+        for (std::uint32_t attempt = 0; attempt < kMaxAttempts && !valid_; ++attempt) {
+            seed_ = kFnvOffset + attempt * kFnvPrime;
+            valid_ = fill();
+        }
+    }
+
+    /**
+     * @return The number of values.
+     */
+    constexpr std::size_t size() const {
+        return N;
+    }
+
+    /**
+     * @return True if a perfect hash was found for the names, false otherwise.
+     */
+    constexpr bool valid() const {
+        return valid_;
+    }
+
+    /**
+     * @param value A value of the enum.
+     * @return The name of the value, empty if the value is out of range.
+     */
+    constexpr std::string_view name(Enum value) const {
+        std::size_t i = static_cast<std::size_t>(value);
+        return i < N ? names_[i] : std::string_view();
+    }
+
+    /**
+     * Parses a name.
+     * @param text The text to parse, which must match a name exactly.
+     * @param value Set to the value of the name if the text matches one.
+     * @return True if the text is one of the names, false otherwise.
+     */
+    constexpr bool parse(std::string_view text, Enum& value) const {
+        std::uint8_t entry = slots_[slotOf(text, seed_)];
+        if (entry == 0 || names_[entry - 1] != text) {
+            return false;
+        }
+        value = static_cast<Enum>(entry - 1);
+        return true;
+    }
+
+private:
+    // Slot table size: the smallest power of two with at least twice as many slots as names
+    static constexpr std::size_t slotBits() {
+        std::size_t bits = 2;
+        while ((std::size_t(1) << bits) < 2 * N) {
+            ++bits;
+        }
+        return bits;
+    }
+
+    static constexpr std::size_t kSlotBits = slotBits();
+    static constexpr std::size_t kSlots = std::size_t(1) << kSlotBits;
+    static constexpr std::uint32_t kFnvOffset = 2166136261u;
+    static constexpr std::uint32_t kFnvPrime = 16777619u;
+    static constexpr std::uint32_t kMaxAttempts = 4096;
+
+    static_assert(N > 0 && N < 255, "EnumTable holds 1 to 254 names");
+
+    static constexpr std::size_t slotOf(std::string_view text, std::uint32_t seed) {
+        std::uint32_t hash = seed;
+        for (char c : text) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * kFnvPrime;
+        }
+        return hash >> (32 - kSlotBits);
+    }
+
+    // Places every name in the slot of its hash under seed_, returns false on a collision
+    constexpr bool fill() {
+        for (std::size_t s = 0; s < kSlots; ++s) {
+            slots_[s] = 0;
+        }
+        for (std::size_t i = 0; i < N; ++i) {
+            std::size_t slot = slotOf(names_[i], seed_);
+            if (slots_[slot] != 0) {
+                return false;
+            }
+            slots_[slot] = static_cast<std::uint8_t>(i + 1);
+        }
+        return true;
+    }
+
+    std::string_view names_[N];
+    std::uint8_t slots_[kSlots];    // index of the name + 1, 0 for an empty slot
+    std::uint32_t seed_;
+    bool valid_;
+};
+
+#endif // ENUM_TABLE_HPP
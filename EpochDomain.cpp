@@ -0,0 +1,144 @@
+/**
+ * @file EpochDomain.cpp
+ * @brief This file contains the implementation of the EpochDomain class.
+ *
+ * A reader stores the epoch it read into its record and then loads the shared pointer; a writer swaps the
+ * pointer and then advances the epoch. All four accesses are sequentially consistent, so a reader either
+ * published its pinned epoch before the writer's scan of the records, or it loads the pointer after the
+ * swap and never sees the retired object. An object retired at epoch e is therefore safe to delete once no
+ * record holds an epoch of e or less.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "EpochDomain.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+// Hands the record of an exiting thread back to its domain
+struct ThreadRecord {
+    void* record = nullptr;
+    std::atomic<bool>* owned = nullptr;
+
+    ~ThreadRecord() {
+        if (owned != nullptr) {
+            owned->store(false, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadRecord t_record;
+
+} // namespace
+
+EpochDomain& EpochDomain::global() {
+    static EpochDomain domain;
+    return domain;
+}
+
+// Constructor and Destructor
+EpochDomain::EpochDomain() : epoch_(1), records_(nullptr) {
+}
+
+EpochDomain::~EpochDomain() {
+    for (const Retired& retired : retired_) {
+        retired.deleter(retired.object);
+    }
+    Record* record = records_.load(std::memory_order_acquire);
+    while (record != nullptr) {
+        Record* next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+// Guard Functions
+EpochDomain::Guard::~Guard() {
+    if (record_ != nullptr) {
+        EpochDomain::global().unpin(record_);
+    }
+}
+
+EpochDomain::Guard EpochDomain::pin() {
+    Record* record = static_cast<Record*>(t_record.record);
+    if (record == nullptr) {
+        record = acquireRecord();
+    }
+    if (record->nesting++ == 0) {
+        record->epoch.store(epoch_.load(std::memory_order_acquire), std::memory_order_seq_cst);
+    }
+    return Guard(record);
+}
+
+void EpochDomain::unpin(Record* record) {
+    if (--record->nesting == 0) {
+        record->epoch.store(0, std::memory_order_release);
+    }
+}
+
+EpochDomain::Record* EpochDomain::acquireRecord() {
+    // Reuse the record of a thread that has exited, or push a new one
+    Record* record = records_.load(std::memory_order_acquire);
+    for (; record != nullptr; record = record->next) {
+        bool expected = false;
+        if (!record->owned.load(std::memory_order_relaxed) &&
+            record->owned.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            break;
+        }
+    }
+    if (record == nullptr) {
+        record = new Record();
+        record->epoch.store(0, std::memory_order_relaxed);
+        record->owned.store(true, std::memory_order_relaxed);
+        record->nesting = 0;
+        record->next = records_.load(std::memory_order_relaxed);
+        while (!records_.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+    t_record.record = record;
+    t_record.owned = &record->owned;
+    return record;
+}
+
+// Reclamation Functions
+void EpochDomain::retire(void* object, void (*deleter)(void* object)) {
+    std::uint64_t epoch = epoch_.fetch_add(1, std::memory_order_seq_cst);
+    {
+        std::lock_guard<std::mutex> lock(retired_mutex_);
+        retired_.push_back(Retired{object, deleter, epoch});
+    }
+    reclaim();
+}
+
+std::size_t EpochDomain::reclaim() {
+    std::vector<Retired> ready;
+    {
+        std::lock_guard<std::mutex> lock(retired_mutex_);
+        if (retired_.empty()) {
+            return 0;
+        }
+        std::uint64_t oldest = std::numeric_limits<std::uint64_t>::max();
+        for (Record* record = records_.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+            std::uint64_t pinned = record->epoch.load(std::memory_order_seq_cst);
+            if (pinned != 0) {
+                oldest = std::min(oldest, pinned);
+            }
+        }
+        auto first_ready = std::partition(retired_.begin(), retired_.end(), [oldest](const Retired& retired) { return retired.epoch >= oldest; });
+        ready.assign(first_ready, retired_.end());
+        retired_.erase(first_ready, retired_.end());
+    }
+    // Delete outside the lock, a destructor may retire further objects
+    for (const Retired& retired : ready) {
+        retired.deleter(retired.object);
+    }
+    return ready.size();
+}
+
+std::size_t EpochDomain::retiredCount() const {
+    std::lock_guard<std::mutex> lock(retired_mutex_);
+    return retired_.size();
+}
@@ -0,0 +1,127 @@
+/**
+ * @file EpochDomain.hpp
+ * @brief This file contains the declaration of the EpochDomain class, epoch-based reclamation of objects that lock-free readers may still hold.
+ *
+ * A reader pins the current epoch before it loads a shared pointer and unpins it when it is done; pinning
+ * is two stores to a record owned by the reading thread, so readers never wait and never write shared
+ * cache lines. A writer first unlinks an object, so no new reader can reach it, and then retires it: the
+ * object is tagged with the epoch of the moment it was retired and deleted once every thread that is still
+ * pinned pinned a later epoch.
+ *
+ * There is one domain per process (see global()). Each thread gets a record the first time it pins and
+ * hands it back when it exits, so the number of records follows the peak number of reading threads.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef EPOCH_DOMAIN_HPP
+#define EPOCH_DOMAIN_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+class EpochDomain {
+    struct Record;
+
+public:
+    /**
+     * A pinned epoch. Objects retired while a guard is alive are not deleted until it is destroyed.
+     * Guards nest, and must be destroyed on the thread that created them.
+     */
+    class Guard {
+    public:
+        Guard(Guard&& other) noexcept : record_(other.record_) {
+            other.record_ = nullptr;
+        }
+
+        ~Guard();
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+
+    private:
+        friend class EpochDomain;
+
+        explicit Guard(Record* record) : record_(record) {
+        }
+
+        Record* record_;
+    };
+
+    /**
+     * @return The process-wide domain.
+     */
+    static EpochDomain& global();
+
+    /**
+     * Destructor.
+     * Deletes every retired object; no thread may be pinned any more.
+     */
+    ~EpochDomain();
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    /**
+     * Pins the current epoch for the calling thread. Takes no lock once the thread has a record.
+     * @return The guard that unpins the epoch.
+     */
+    Guard pin();
+
+    /**
+     * Deletes an object once no reader can hold it any more. The object must already be unreachable for
+     * new readers.
+     * @param object A pointer to an object allocated with new.
+     */
+    template <typename T>
+    void retire(T* object);
+
+    /**
+     * Deletes the retired objects no pinned thread can hold.
+     * @return The number of objects deleted.
+     */
+    std::size_t reclaim();
+
+    /**
+     * @return The number of retired objects not deleted yet.
+     */
+    std::size_t retiredCount() const;
+
+private:
+    struct alignas(64) Record {
+        std::atomic<std::uint64_t> epoch;   // the pinned epoch, 0 while the thread is not pinned
+        std::atomic<bool> owned;            // true while a thread uses the record
+        Record* next;                       // records are never unlinked
+        unsigned nesting;                   // guards alive on the owning thread
+    };
+
+    struct Retired {
+        void* object;
+        void (*deleter)(void* object);
+        std::uint64_t epoch;
+    };
+
+    EpochDomain();
+
+    void unpin(Record* record);
+    Record* acquireRecord();
+    void retire(void* object, void (*deleter)(void* object));
+
+    std::atomic<std::uint64_t> epoch_;                  // starts at 1, so 0 can mean not pinned
+    std::atomic<Record*> records_;
+    mutable std::mutex retired_mutex_;
+    std::vector<Retired> retired_;                      // guarded by retired_mutex_
+};
+
+// Template Functions
+template <typename T>
+void EpochDomain::retire(T* object) {
+    retire(static_cast<void*>(object), [](void* retired) { delete static_cast<T*>(retired); });
+}
+
+#endif // EPOCH_DOMAIN_HPP
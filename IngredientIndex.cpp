@@ -0,0 +1,275 @@
+/**
+ * @file IngredientIndex.cpp
+ * @brief This file contains the implementation of the IngredientIndex class.
+ *
+ * A change is handled in two steps: dishChanging() takes the dish id out of the bitmaps the old value put
+ * it in, and dishChanged() adds it to the bitmaps of the new value.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "IngredientIndex.hpp"
+
+namespace {
+
+const RoaringBitmap kEmptyBitmap;
+
+} // namespace
+
+// Constructor and Destructor
+IngredientIndex::IngredientIndex() {
+}
+
+IngredientIndex::~IngredientIndex() {
+    for (const Entry& entry : entries_) {
+        if (entry.dish != nullptr && entry.dish->getObserver() == this) {
+            entry.dish->setObserver(nullptr);
+        }
+    }
+}
+
+// Membership Functions
+IngredientIndex::DishId IngredientIndex::add(Dish& dish) {
+    return insert(dish, DishCatalog::Course::DISH);
+}
+
+IngredientIndex::DishId IngredientIndex::add(Appetizer& appetizer) {
+    return insert(appetizer, DishCatalog::Course::APPETIZER);
+}
+
+IngredientIndex::DishId IngredientIndex::add(MainCourse& main_course) {
+    return insert(main_course, DishCatalog::Course::MAIN_COURSE);
+}
+
+IngredientIndex::DishId IngredientIndex::add(Dessert& dessert) {
+    return insert(dessert, DishCatalog::Course::DESSERT);
+}
+
+void IngredientIndex::remove(const Dish& dish) {
+    auto found = ids_.find(&dish);
+    if (found == ids_.end()) {
+        return;
+    }
+    DishId id = found->second;
+    Entry& entry = entries_[id];
+    unindexIngredients(id, dish);
+    unindexFlag(id);
+    by_course_[static_cast<int>(entry.course)].remove(id);
+    all_.remove(id);
+    if (entry.dish->getObserver() == this) {
+        entry.dish->setObserver(nullptr);
+    }
+    entry.dish = nullptr;
+    ids_.erase(found);
+    free_ids_.push_back(id);
+}
+
+bool IngredientIndex::find(const Dish& dish, DishId& id) const {
+    auto found = ids_.find(&dish);
+    if (found == ids_.end()) {
+        return false;
+    }
+    id = found->second;
+    return true;
+}
+
+const Dish* IngredientIndex::dish(DishId id) const {
+    return id < entries_.size() ? entries_[id].dish : nullptr;
+}
+
+std::size_t IngredientIndex::size() const {
+    return ids_.size();
+}
+
+// Posting Lists
+const RoaringBitmap& IngredientIndex::all() const {
+    return all_;
+}
+
+const RoaringBitmap& IngredientIndex::withIngredient(SymbolTable::Id ingredient_id) const {
+    return ingredient_id < by_ingredient_.size() ? by_ingredient_[ingredient_id] : kEmptyBitmap;
+}
+
+const RoaringBitmap& IngredientIndex::withIngredient(std::string_view ingredient) const {
+    SymbolTable::Id ingredient_id;
+    if (!SymbolTable::ingredients().find(ingredient, ingredient_id)) {
+        return kEmptyBitmap;
+    }
+    return withIngredient(ingredient_id);
+}
+
+const RoaringBitmap& IngredientIndex::ofCourse(DishCatalog::Course course) const {
+    return by_course_[static_cast<int>(course)];
+}
+
+const RoaringBitmap& IngredientIndex::vegetarian() const {
+    return vegetarian_;
+}
+
+const RoaringBitmap& IngredientIndex::glutenFree() const {
+    return gluten_free_;
+}
+
+const RoaringBitmap& IngredientIndex::containsNuts() const {
+    return contains_nuts_;
+}
+
+// Queries
+RoaringBitmap IngredientIndex::withAllOf(ArrayView<SymbolTable::Id> ingredient_ids) const {
+    if (ingredient_ids.empty()) {
+        return all_;
+    }
+    RoaringBitmap result = withIngredient(ingredient_ids[0]);
+    for (std::size_t i = 1; i < ingredient_ids.size() && !result.empty(); ++i) {
+        result = result.intersect(withIngredient(ingredient_ids[i]));
+    }
+    return result;
+}
+
+RoaringBitmap IngredientIndex::withAnyOf(ArrayView<SymbolTable::Id> ingredient_ids) const {
+    RoaringBitmap result;
+    for (SymbolTable::Id ingredient_id : ingredient_ids) {
+        result = result.unite(withIngredient(ingredient_id));
+    }
+    return result;
+}
+
+RoaringBitmap IngredientIndex::withNoneOf(ArrayView<SymbolTable::Id> ingredient_ids) const {
+    return all_.subtract(withAnyOf(ingredient_ids));
+}
+
+// DishObserver Notifications
+void IngredientIndex::dishChanging(const Dish& dish, Field field) {
+    auto found = ids_.find(&dish);
+    if (found == ids_.end()) {
+        return;
+    }
+    if (touchesIngredients(field)) {
+        unindexIngredients(found->second, dish);
+    }
+    if (touchesFlag(field)) {
+        unindexFlag(found->second);
+    }
+}
+
+void IngredientIndex::dishChanged(const Dish& dish, Field field) {
+    auto found = ids_.find(&dish);
+    if (found == ids_.end()) {
+        return;
+    }
+    if (touchesIngredients(field)) {
+        indexIngredients(found->second, dish);
+    }
+    if (touchesFlag(field)) {
+        indexFlag(found->second);
+    }
+}
+
+void IngredientIndex::dishMoved(const Dish& from, const Dish& to) noexcept {
+    auto found = ids_.find(&from);
+    if (found == ids_.end()) {
+        return;
+    }
+    // Rekey the node in place, an erase and emplace could fail to allocate inside the noexcept move constructor
+    auto node = ids_.extract(found);
+    node.key() = &to;
+    DishId id = node.mapped();
+    ids_.insert(std::move(node));
+    entries_[id].dish = const_cast<Dish*>(&to);  // The index only holds dishes added through a non-const reference
+}
+
+void IngredientIndex::dishDestroyed(const Dish& dish) {
+    auto found = ids_.find(&dish);
+    if (found == ids_.end()) {
+        return;
+    }
+    DishId id = found->second;
+    Entry& entry = entries_[id];
+    unindexIngredients(id, dish);
+    vegetarian_.remove(id);  // The derived members are already gone, so clear the flag without reading it
+    gluten_free_.remove(id);
+    contains_nuts_.remove(id);
+    by_course_[static_cast<int>(entry.course)].remove(id);
+    all_.remove(id);
+    entry.dish = nullptr;
+    ids_.erase(found);
+    free_ids_.push_back(id);
+}
+
+// Index Helpers
+IngredientIndex::DishId IngredientIndex::insert(Dish& dish, DishCatalog::Course course) {
+    DishId id;
+    if (!free_ids_.empty()) {
+        id = free_ids_.back();
+        free_ids_.pop_back();
+        entries_[id] = {&dish, course};
+    } else {
+        id = static_cast<DishId>(entries_.size());
+        entries_.push_back({&dish, course});
+    }
+    ids_.emplace(&dish, id);
+    all_.add(id);
+    by_course_[static_cast<int>(course)].add(id);
+    indexIngredients(id, dish);
+    indexFlag(id);
+    if (dish.getObserver() == nullptr) {
+        dish.setObserver(this);
+    }
+    return id;
+}
+
+void IngredientIndex::indexIngredients(DishId id, const Dish& dish) {
+    for (SymbolTable::Id ingredient_id : dish.getIngredientIdsView()) {
+        if (ingredient_id >= by_ingredient_.size()) {
+            by_ingredient_.resize(ingredient_id + 1);
+        }
+        by_ingredient_[ingredient_id].add(id);
+    }
+}
+
+void IngredientIndex::unindexIngredients(DishId id, const Dish& dish) {
+    for (SymbolTable::Id ingredient_id : dish.getIngredientIdsView()) {
+        by_ingredient_[ingredient_id].remove(id);
+    }
+}
+
+void IngredientIndex::indexFlag(DishId id) {
+    const Entry& entry = entries_[id];
+    switch (entry.course) {
+        case DishCatalog::Course::APPETIZER:
+            if (static_cast<const Appetizer*>(entry.dish)->isVegetarian()) {
+                vegetarian_.add(id);
+            }
+            break;
+        case DishCatalog::Course::MAIN_COURSE:
+            if (static_cast<const MainCourse*>(entry.dish)->isGlutenFree()) {
+                gluten_free_.add(id);
+            }
+            break;
+        case DishCatalog::Course::DESSERT:
+            if (static_cast<const Dessert*>(entry.dish)->containsNuts()) {
+                contains_nuts_.add(id);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void IngredientIndex::unindexFlag(DishId id) {
+    switch (entries_[id].course) {
+        case DishCatalog::Course::APPETIZER: vegetarian_.remove(id); break;
+        case DishCatalog::Course::MAIN_COURSE: gluten_free_.remove(id); break;
+        case DishCatalog::Course::DESSERT: contains_nuts_.remove(id); break;
+        default: break;
+    }
+}
+
+bool IngredientIndex::touchesIngredients(Field field) {
+    return field == Field::ALL || field == Field::INGREDIENTS;
+}
+
+bool IngredientIndex::touchesFlag(Field field) {
+    return field == Field::ALL || field == Field::VEGETARIAN || field == Field::GLUTEN_FREE || field == Field::CONTAINS_NUTS;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file IngredientIndex.hpp
+ * @brief This file contains the declaration of the IngredientIndex class, an inverted index from ingredients and dietary flags to dishes.
+ *
+ * Every dish added to the index gets a small dish id. The index keeps one RoaringBitmap of dish ids per
+ * ingredient, one per dietary flag (vegetarian appetizers, gluten-free main courses, desserts with nuts)
+ * and one per course, so a query such as "contains garlic and not peanuts" is a couple of bitmap
+ * operations instead of a scan over every dish. The index observes its dishes (see DishObserver) and
+ * updates the bitmaps when setIngredients() or a flag setter is called, when a dish is assigned or moved
+ * and when it is destroyed.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef INGREDIENT_INDEX_HPP
+#define INGREDIENT_INDEX_HPP
+
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include "DishCatalog.hpp"
+#include "RoaringBitmap.hpp"
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class IngredientIndex : public DishObserver {
+public:
+    // DishId type definition, the position of a dish in the index
+    using DishId = std::uint32_t;
+
+    /**
+     * Default constructor.
+     * Creates an empty index.
+     */
+    IngredientIndex();
+
+    /**
+     * Destructor.
+     * Stops observing the dishes that have the index as their observer.
+     */
+    ~IngredientIndex();
+
+    IngredientIndex(const IngredientIndex&) = delete;
+    IngredientIndex& operator=(const IngredientIndex&) = delete;
+
+    /**
+     * Adds a dish to the index. If the dish has no observer the index becomes its observer; otherwise the
+     * index must be in the DishObserverList the dish reports to.
+     * @param dish A reference to the dish, which must not already be in the index.
+     * @return The id of the dish in the index.
+     */
+    DishId add(Dish& dish);
+    DishId add(Appetizer& appetizer);
+    DishId add(MainCourse& main_course);
+    DishId add(Dessert& dessert);
+
+    /**
+     * Removes a dish from the index; its id may be given to a dish added later.
+     * @param dish A reference to the dish.
+     */
+    void remove(const Dish& dish);
+
+    /**
+     * @param dish A reference to a dish.
+     * @param id Set to the id of the dish if it is in the index.
+     * @return True if the dish is in the index, false otherwise.
+     */
+    bool find(const Dish& dish, DishId& id) const;
+
+    /**
+     * @param id The id of a dish in the index.
+     * @return A pointer to the dish, nullptr if the id is not in use.
+     */
+    const Dish* dish(DishId id) const;
+
+    /**
+     * @return The number of dishes in the index.
+     */
+    std::size_t size() const;
+
+    // Posting lists, each stays valid until the index changes
+    /**
+     * @return The ids of every dish in the index.
+     */
+    const RoaringBitmap& all() const;
+
+    /**
+     * @param ingredient_id The id of an ingredient (see SymbolTable::ingredients()).
+     * @return The ids of the dishes that use the ingredient.
+     */
+    const RoaringBitmap& withIngredient(SymbolTable::Id ingredient_id) const;
+
+    /**
+     * @param ingredient The name of an ingredient.
+     * @return The ids of the dishes that use the ingredient.
+     */
+    const RoaringBitmap& withIngredient(std::string_view ingredient) const;
+
+    /**
+     * @param course A course.
+     * @return The ids of the dishes added as that course.
+     */
+    const RoaringBitmap& ofCourse(DishCatalog::Course course) const;
+
+    /**
+     * @return The ids of the vegetarian appetizers.
+     */
+    const RoaringBitmap& vegetarian() const;
+
+    /**
+     * @return The ids of the gluten-free main courses.
+     */
+    const RoaringBitmap& glutenFree() const;
+
+    /**
+     * @return The ids of the desserts that contain nuts.
+     */
+    const RoaringBitmap& containsNuts() const;
+
+    // Queries
+    /**
+     * @param ingredient_ids The ids of the ingredients.
+     * @return The ids of the dishes that use every one of the ingredients.
+     */
+    RoaringBitmap withAllOf(ArrayView<SymbolTable::Id> ingredient_ids) const;
+
+    /**
+     * @param ingredient_ids The ids of the ingredients.
+     * @return The ids of the dishes that use at least one of the ingredients.
+     */
+    RoaringBitmap withAnyOf(ArrayView<SymbolTable::Id> ingredient_ids) const;
+
+    /**
+     * @param ingredient_ids The ids of the ingredients.
+     * @return The ids of the dishes that use none of the ingredients.
+     */
+    RoaringBitmap withNoneOf(ArrayView<SymbolTable::Id> ingredient_ids) const;
+
+    // DishObserver notifications
+    void dishChanging(const Dish& dish, Field field) override;
+    void dishChanged(const Dish& dish, Field field) override;
+    void dishMoved(const Dish& from, const Dish& to) noexcept override;
+    void dishDestroyed(const Dish& dish) override;
+
+private:
+    struct Entry {
+        Dish* dish;
+        DishCatalog::Course course;
+    };
+
+    DishId insert(Dish& dish, DishCatalog::Course course);
+    void indexIngredients(DishId id, const Dish& dish);
+    void unindexIngredients(DishId id, const Dish& dish);
+    void indexFlag(DishId id);
+    void unindexFlag(DishId id);
+
+    static bool touchesIngredients(Field field);
+    static bool touchesFlag(Field field);
+
+    std::vector<Entry> entries_;                    // by dish id, dish is nullptr for free ids
+    std::vector<DishId> free_ids_;
+    std::unordered_map<const Dish*, DishId> ids_;
+    std::vector<RoaringBitmap> by_ingredient_;      // by ingredient id
+    RoaringBitmap all_;
+    RoaringBitmap by_course_[4];
+    RoaringBitmap vegetarian_;
+    RoaringBitmap gluten_free_;
+    RoaringBitmap contains_nuts_;
+};
+
+#endif // INGREDIENT_INDEX_HPP
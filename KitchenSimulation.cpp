@@ -0,0 +1,597 @@
+/**
+ * @file KitchenSimulation.cpp
+ * @brief This file contains the implementation of the KitchenSimulation class.
+ *
+ * Each table and each station line is a logical process owned by one partition (table % thread_count and
+ * line % thread_count). A partition keeps its pending events in a calendar queue with one bucket per
+ * simulated second, which is cheaper than a binary heap because every event is scheduled at most one
+ * preparation time ahead. It processes its events in (time, kind, id) order up to the end of the current
+ * window, sends events for other partitions to per-destination outboxes, and waits at a barrier.
+ * Every event sent between logical processes is at least handoff_time in the future, so it always falls
+ * into a later window; the next window starts at the earliest pending event of any partition.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "KitchenSimulation.hpp"
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <thread>
+
+namespace {
+
+using Time = KitchenSimulation::Time;
+using Station = KitchenSimulation::Station;
+
+const Time kNever = std::numeric_limits<Time>::max();
+
+// The courses are served in three stages: appetizers, main courses and plain dishes, desserts
+const unsigned kStageCount = 3;
+
+constexpr std::string_view kStationNames[] = {"LINE", "COLD", "GRILL", "OVEN", "FRYER", "STEAMER", "PASTRY"};
+static_assert(sizeof(kStationNames) / sizeof(kStationNames[0]) == KitchenSimulation::kStationCount, "one name per station");
+
+// Blocks until every thread of the group has called wait(). The windows are short, so waiting threads
+// yield instead of sleeping on a condition variable.
+class Barrier {
+public:
+    explicit Barrier(std::size_t count) : count_(count), waiting_(0), generation_(0) {
+    }
+
+    void wait() {
+        std::size_t generation = generation_.load(std::memory_order_acquire);
+        if (waiting_.fetch_add(1, std::memory_order_acq_rel) + 1 == count_) {
+            waiting_.store(0, std::memory_order_relaxed);
+            generation_.store(generation + 1, std::memory_order_release);
+        } else {
+            while (generation_.load(std::memory_order_acquire) == generation) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    std::size_t count_;
+    std::atomic<std::size_t> waiting_;
+    std::atomic<std::size_t> generation_;
+};
+
+// Event definition, ordered by time, then kind, then id so the order does not depend on the partitioning
+struct Event {
+    enum Kind : std::uint8_t { DONE, SERVED, FIRE, ARRIVAL };
+
+    Time time;
+    std::uint32_t id;   // the order for ARRIVAL, the item otherwise
+    Kind kind;
+
+    bool operator>(const Event& other) const {
+        if (time != other.time) {
+            return time > other.time;
+        }
+        if (kind != other.kind) {
+            return kind > other.kind;
+        }
+        return id > other.id;
+    }
+};
+
+// Calendar queue: one bucket of events per second in a ring that covers the longest delay an event can have
+class EventWheel {
+public:
+    EventWheel() : mask_(0), now_(0), cursor_(0), pending_(0) {
+    }
+
+    // Empties the wheel; every event pushed later must be less than `horizon` seconds after the current time
+    void reset(Time horizon) {
+        std::size_t size = 1;
+        while (static_cast<Time>(size) < horizon) {
+            size *= 2;
+        }
+        buckets_.assign(size, std::vector<Event>());
+        mask_ = size - 1;
+        now_ = 0;
+        cursor_ = 0;
+        pending_ = 0;
+    }
+
+    void push(const Event& event) {
+        buckets_[static_cast<std::size_t>(event.time) & mask_].push_back(event);
+        cursor_ = std::min(cursor_, event.time);
+        ++pending_;
+    }
+
+    // Returns the time of the earliest event, kNever if the wheel is empty
+    Time nextTime() {
+        if (pending_ == 0) {
+            return kNever;
+        }
+        while (buckets_[static_cast<std::size_t>(cursor_) & mask_].empty()) {
+            ++cursor_;
+        }
+        return cursor_;
+    }
+
+    // Moves the events of the earliest time into `batch`, sorted; events pushed for the same time meanwhile
+    // are returned by the next call
+    void take(std::vector<Event>& batch) {
+        now_ = nextTime();
+        std::vector<Event>& bucket = buckets_[static_cast<std::size_t>(now_) & mask_];
+        batch.clear();
+        batch.swap(bucket);
+        pending_ -= batch.size();
+        std::sort(batch.begin(), batch.end(), [](const Event& a, const Event& b) { return b > a; });
+    }
+
+    // Moves the current time forward, no event is earlier than `time`
+    void advance(Time time) {
+        now_ = std::max(now_, time);
+        cursor_ = std::max(cursor_, now_);
+    }
+
+private:
+    std::vector<std::vector<Event>> buckets_;
+    std::size_t mask_;
+    Time now_;
+    Time cursor_;       // no event is earlier than the cursor
+    std::size_t pending_;
+};
+
+struct TableState {
+    Time arrival;
+    std::uint32_t remaining;    // items of the current stage not served yet
+    unsigned stage;
+};
+
+struct LineState {
+    struct Queued {
+        std::uint32_t item;
+        Time fired;
+    };
+
+    unsigned busy = 0;
+    std::deque<Queued> queue;
+};
+
+struct Partition {
+    std::vector<Event> arrivals;                            // sorted, consumed from next_arrival
+    std::size_t next_arrival = 0;
+    EventWheel wheel;                                       // events in flight
+    std::vector<Event> batch;                               // the events of the time being processed
+
+    // Returns the time of the earliest pending event, kNever if there is none
+    Time nextTime() {
+        return std::min(wheel.nextTime(), nextArrivalTime());
+    }
+
+    Time nextArrivalTime() const {
+        return next_arrival < arrivals.size() ? arrivals[next_arrival].time : kNever;
+    }
+
+    std::vector<TableState> tables;                         // by order / thread_count
+    std::vector<LineState> lines;                           // by line / thread_count
+    std::vector<std::vector<Event>> outbox;                 // by destination partition
+    std::vector<std::vector<std::uint32_t>> latencies;      // by menu index
+    KitchenSimulation::StationStats stations[KitchenSimulation::kStationCount];
+    std::size_t events = 0;
+    Time last_time = 0;
+};
+
+// The state of one run, shared by the partitions; everything but the partitions is read-only while running
+class Simulation {
+public:
+    Simulation(const KitchenSimulation::Options& options, std::size_t menu_size, std::size_t order_count)
+        : options_(options), partition_count_(options.thread_count), station_(menu_size), stage_(menu_size),
+          prep_time_(menu_size), partitions_(options.thread_count), next_times_(options.thread_count, kNever),
+          barrier_(options.thread_count), windows_(0) {
+        std::uint32_t line = 0;
+        for (std::size_t s = 0; s < KitchenSimulation::kStationCount; ++s) {
+            first_line_[s] = line;
+            line += options.lines[s];
+        }
+        for (std::size_t p = 0; p < partition_count_; ++p) {
+            Partition& partition = partitions_[p];
+            partition.tables.resize((order_count + partition_count_ - 1 - p) / partition_count_);
+            partition.lines.resize((line + partition_count_ - 1 - p) / partition_count_);
+            partition.outbox.resize(partition_count_);
+            partition.latencies.resize(menu_size);
+        }
+    }
+
+    // Per menu index: where and how long the item is cooked
+    void setMenuItem(std::size_t index, Station station, unsigned stage, Time prep_time) {
+        station_[index] = station;
+        stage_[index] = static_cast<std::uint8_t>(stage);
+        prep_time_[index] = prep_time;
+    }
+
+    void setItems(const std::vector<std::uint32_t>& items, std::vector<std::uint32_t>&& item_orders) {
+        items_ = &items;
+        item_orders_ = std::move(item_orders);
+    }
+
+    // Per order: the arrival time and the position of its first item, plus the end of the last order
+    void setOrders(std::vector<Time>&& arrivals, std::vector<std::uint32_t>&& first_items) {
+        order_arrivals_ = std::move(arrivals);
+        order_first_items_ = std::move(first_items);
+    }
+
+    // Seeds the arrivals, runs every partition to completion and merges the results into the report
+    void run(std::size_t order_count, KitchenSimulation::Report& report);
+
+private:
+    void runPartition(std::size_t p);
+    void process(std::size_t p, Time window_end);
+    void handle(std::size_t p, const Event& event);
+    void send(std::size_t from, std::size_t to, const Event& event);
+    void fireStage(std::size_t p, std::uint32_t order, Time now);
+    void startItem(std::size_t p, LineState& line, std::uint32_t item, Time fired, Time now);
+
+    std::uint32_t lineOf(std::uint32_t item) const {
+        Station station = station_[(*items_)[item]];
+        std::size_t s = static_cast<std::size_t>(station);
+        return first_line_[s] + item % options_.lines[s];
+    }
+
+    const KitchenSimulation::Options& options_;
+    std::size_t partition_count_;
+    std::uint32_t first_line_[KitchenSimulation::kStationCount];
+    std::vector<Station> station_;          // by menu index
+    std::vector<std::uint8_t> stage_;       // by menu index
+    std::vector<Time> prep_time_;           // by menu index
+    const std::vector<std::uint32_t>* items_ = nullptr;
+    std::vector<std::uint32_t> item_orders_;
+    std::vector<Time> order_arrivals_;
+    std::vector<std::uint32_t> order_first_items_;  // order_count + 1 entries
+    std::vector<Partition> partitions_;
+    std::vector<Time> next_times_;          // by partition, the earliest pending event after a window
+    Barrier barrier_;
+    std::size_t windows_;
+};
+
+} // namespace
+
+// Constructors
+KitchenSimulation::KitchenSimulation(const Menu& menu)
+    : KitchenSimulation(menu, Options()) {
+}
+
+KitchenSimulation::KitchenSimulation(const Menu& menu, const Options& options)
+    : menu_(menu), options_(options) {
+}
+
+// Order Functions
+void KitchenSimulation::reserve(std::size_t orders, std::size_t items) {
+    orders_.reserve(orders);
+    items_.reserve(items);
+}
+
+bool KitchenSimulation::addOrder(Time arrival, ArrayView<std::uint32_t> menu_items, std::string& error) {
+    if (arrival < 0) {
+        error = "negative arrival time " + std::to_string(arrival);
+        return false;
+    }
+    if (menu_items.empty()) {
+        error = "empty order";
+        return false;
+    }
+    for (std::uint32_t menu_index : menu_items) {
+        if (menu_index >= menu_.size()) {
+            error = "menu index " + std::to_string(menu_index) + " out of range";
+            return false;
+        }
+    }
+    orders_.push_back({arrival, static_cast<std::uint32_t>(items_.size()), static_cast<std::uint32_t>(menu_items.size())});
+    items_.insert(items_.end(), menu_items.begin(), menu_items.end());
+    return true;
+}
+
+std::size_t KitchenSimulation::orderCount() const {
+    return orders_.size();
+}
+
+const KitchenSimulation::Options& KitchenSimulation::options() const {
+    return options_;
+}
+
+void KitchenSimulation::setOptions(const Options& options) {
+    options_ = options;
+}
+
+// Simulation
+bool KitchenSimulation::run(Report& report, std::string& error) const {
+    if (options_.handoff_time < 1) {
+        error = "handoff time must be at least 1";
+        return false;
+    }
+    if (options_.cooks_per_line == 0 || options_.thread_count == 0) {
+        error = "cooks per line and thread count must be at least 1";
+        return false;
+    }
+    for (std::size_t s = 0; s < kStationCount; ++s) {
+        if (options_.lines[s] == 0) {
+            error = "station " + std::string(stationName(static_cast<Station>(s))) + " has no lines";
+            return false;
+        }
+    }
+
+    Simulation simulation(options_, menu_.size(), orders_.size());
+    for (std::size_t i = 0; i < menu_.size(); ++i) {
+        const Menu::Item& item = menu_[i];
+        unsigned stage;
+        switch (Menu::course(item)) {
+            case Dish::Course::APPETIZER: stage = 0; break;
+            case Dish::Course::DESSERT: stage = 2; break;
+            default: stage = 1; break;
+        }
+        Time prep_time = std::max(Menu::dish(item).getPrepTime(), 0);
+        simulation.setMenuItem(i, stationOf(item), stage, prep_time * 60);
+    }
+
+    std::vector<std::uint32_t> item_orders(items_.size());
+    std::vector<Time> arrivals;
+    std::vector<std::uint32_t> first_items;
+    arrivals.reserve(orders_.size());
+    first_items.reserve(orders_.size() + 1);
+    for (std::uint32_t o = 0; o < orders_.size(); ++o) {
+        const Order& order = orders_[o];
+        for (std::uint32_t i = order.first_item; i < order.first_item + order.item_count; ++i) {
+            if (items_[i] >= menu_.size()) {
+                error = "menu index " + std::to_string(items_[i]) + " out of range, the menu has shrunk";
+                return false;
+            }
+            item_orders[i] = o;
+        }
+        arrivals.push_back(order.arrival);
+        first_items.push_back(order.first_item);
+    }
+    first_items.push_back(static_cast<std::uint32_t>(items_.size()));
+    simulation.setOrders(std::move(arrivals), std::move(first_items));
+    simulation.setItems(items_, std::move(item_orders));
+
+    simulation.run(orders_.size(), report);
+    return true;
+}
+
+// Station Functions
+KitchenSimulation::Station KitchenSimulation::stationOf(const Menu::Item& item) {
+    switch (Menu::course(item)) {
+        case Dish::Course::APPETIZER:
+            return Station::COLD;
+        case Dish::Course::DESSERT:
+            return Station::PASTRY;
+        case Dish::Course::MAIN_COURSE:
+            switch (std::get<MainCourse>(item).getCookingMethod()) {
+                case MainCourse::CookingMethod::GRILLED: return Station::GRILL;
+                case MainCourse::CookingMethod::BAKED: return Station::OVEN;
+                case MainCourse::CookingMethod::FRIED: return Station::FRYER;
+                case MainCourse::CookingMethod::STEAMED: return Station::STEAMER;
+                case MainCourse::CookingMethod::RAW: return Station::COLD;
+            }
+            return Station::LINE;
+        default:
+            return Station::LINE;
+    }
+}
+
+std::string_view KitchenSimulation::stationName(Station station) {
+    std::size_t s = static_cast<std::size_t>(station);
+    return s < kStationCount ? kStationNames[s] : std::string_view();
+}
+
+// Run Functions
+void Simulation::run(std::size_t order_count, KitchenSimulation::Report& report) {
+    // The arrivals are known up front, so they are merged from a sorted list instead of going through the wheel
+    Time horizon = options_.handoff_time;
+    for (Time prep_time : prep_time_) {
+        horizon = std::max(horizon, prep_time);
+    }
+    for (Partition& partition : partitions_) {
+        partition.wheel.reset(horizon + 1);
+    }
+    for (std::uint32_t o = 0; o < order_count; ++o) {
+        partitions_[o % partition_count_].arrivals.push_back({order_arrivals_[o], o, Event::ARRIVAL});
+    }
+    for (std::size_t p = 0; p < partition_count_; ++p) {
+        std::vector<Event>& arrivals = partitions_[p].arrivals;
+        std::sort(arrivals.begin(), arrivals.end(), [](const Event& a, const Event& b) { return b > a; });
+        next_times_[p] = partitions_[p].nextTime();
+    }
+
+    std::vector<std::thread> threads;
+    for (std::size_t p = 1; p < partition_count_; ++p) {
+        threads.emplace_back(&Simulation::runPartition, this, p);
+    }
+    runPartition(0);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Merge the partitions
+    report = KitchenSimulation::Report();
+    report.orders = order_count;
+    report.items = items_->size();
+    report.windows = windows_;
+    for (const Partition& partition : partitions_) {
+        report.events += partition.events;
+        report.end_time = std::max(report.end_time, partition.last_time);
+        for (std::size_t s = 0; s < KitchenSimulation::kStationCount; ++s) {
+            KitchenSimulation::StationStats& stats = report.stations[s];
+            stats.cooked += partition.stations[s].cooked;
+            stats.busy_time += partition.stations[s].busy_time;
+            stats.total_wait += partition.stations[s].total_wait;
+            stats.max_queue = std::max(stats.max_queue, partition.stations[s].max_queue);
+        }
+    }
+    for (std::size_t s = 0; s < KitchenSimulation::kStationCount; ++s) {
+        double capacity = static_cast<double>(options_.lines[s]) * options_.cooks_per_line * static_cast<double>(report.end_time);
+        report.stations[s].utilization = capacity > 0.0 ? static_cast<double>(report.stations[s].busy_time) / capacity : 0.0;
+    }
+
+    // Nearest-rank percentiles, each nth_element only looks at the values above the previous rank
+    report.dishes.resize(station_.size());
+    std::vector<std::uint32_t> latencies;
+    for (std::size_t m = 0; m < station_.size(); ++m) {
+        latencies.clear();
+        for (Partition& partition : partitions_) {
+            latencies.insert(latencies.end(), partition.latencies[m].begin(), partition.latencies[m].end());
+            std::vector<std::uint32_t>().swap(partition.latencies[m]);
+        }
+        KitchenSimulation::DishStats& stats = report.dishes[m];
+        stats.served = latencies.size();
+        if (latencies.empty()) {
+            continue;
+        }
+        double total = 0.0;
+        for (std::uint32_t latency : latencies) {
+            total += latency;
+        }
+        stats.mean_latency = total / static_cast<double>(latencies.size());
+        const double ranks[] = {0.50, 0.90, 0.99};
+        Time* results[] = {&stats.p50_latency, &stats.p90_latency, &stats.p99_latency};
+        auto begin = latencies.begin();
+        for (int r = 0; r < 3; ++r) {
+            std::size_t rank = static_cast<std::size_t>(ranks[r] * static_cast<double>(latencies.size()) + 0.999999);
+            auto nth = latencies.begin() + static_cast<std::ptrdiff_t>(std::max<std::size_t>(rank, 1) - 1);
+            std::nth_element(begin, nth, latencies.end());
+            *results[r] = *nth;
+            begin = nth;
+        }
+        stats.max_latency = *std::max_element(begin, latencies.end());
+    }
+}
+
+void Simulation::runPartition(std::size_t p) {
+    Partition& partition = partitions_[p];
+    for (;;) {
+        // Every partition reads the same next times, so they agree on the window and on when to stop
+        Time start = *std::min_element(next_times_.begin(), next_times_.end());
+        if (start == kNever) {
+            break;
+        }
+        if (p == 0) {
+            ++windows_;
+        }
+        process(p, start + options_.handoff_time);
+        barrier_.wait();
+
+        for (Partition& source : partitions_) {
+            std::vector<Event>& inbox = source.outbox[p];
+            for (const Event& event : inbox) {
+                partition.wheel.push(event);
+            }
+            inbox.clear();
+        }
+        next_times_[p] = partition.nextTime();
+        barrier_.wait();
+    }
+}
+
+void Simulation::process(std::size_t p, Time window_end) {
+    // The wheel goes first on equal times, as ARRIVAL is the last event kind
+    Partition& partition = partitions_[p];
+    for (;;) {
+        Time wheel_time = partition.wheel.nextTime();
+        Time arrival_time = partition.nextArrivalTime();
+        if (std::min(wheel_time, arrival_time) >= window_end) {
+            break;
+        }
+        if (wheel_time <= arrival_time) {
+            partition.wheel.take(partition.batch);
+            for (const Event& event : partition.batch) {
+                handle(p, event);
+            }
+        } else {
+            handle(p, partition.arrivals[partition.next_arrival++]);
+        }
+    }
+    partition.wheel.advance(window_end);
+}
+
+void Simulation::handle(std::size_t p, const Event& event) {
+    Partition& partition = partitions_[p];
+    ++partition.events;
+    partition.last_time = std::max(partition.last_time, event.time);
+
+    switch (event.kind) {
+        case Event::ARRIVAL: {
+            TableState& table = partition.tables[event.id / partition_count_];
+            table.arrival = event.time;
+            table.stage = 0;
+            fireStage(p, event.id, event.time);
+            break;
+        }
+        case Event::FIRE: {
+            LineState& line = partition.lines[lineOf(event.id) / partition_count_];
+            if (line.busy < options_.cooks_per_line) {
+                startItem(p, line, event.id, event.time, event.time);
+            } else {
+                line.queue.push_back({event.id, event.time});
+                KitchenSimulation::StationStats& stats = partition.stations[static_cast<std::size_t>(station_[(*items_)[event.id]])];
+                stats.max_queue = std::max(stats.max_queue, line.queue.size());
+            }
+            break;
+        }
+        case Event::DONE: {
+            LineState& line = partition.lines[lineOf(event.id) / partition_count_];
+            --line.busy;
+            send(p, item_orders_[event.id] % partition_count_, {event.time + options_.handoff_time, event.id, Event::SERVED});
+            if (!line.queue.empty()) {
+                LineState::Queued next = line.queue.front();
+                line.queue.pop_front();
+                startItem(p, line, next.item, next.fired, event.time);
+            }
+            break;
+        }
+        case Event::SERVED: {
+            std::uint32_t order = item_orders_[event.id];
+            TableState& table = partition.tables[order / partition_count_];
+            partition.latencies[(*items_)[event.id]].push_back(static_cast<std::uint32_t>(event.time - table.arrival));
+            if (--table.remaining == 0) {
+                ++table.stage;
+                fireStage(p, order, event.time);
+            }
+            break;
+        }
+    }
+}
+
+void Simulation::send(std::size_t from, std::size_t to, const Event& event) {
+    if (from == to) {
+        partitions_[from].wheel.push(event);
+    } else {
+        partitions_[from].outbox[to].push_back(event);
+    }
+}
+
+void Simulation::fireStage(std::size_t p, std::uint32_t order, Time now) {
+    TableState& table = partitions_[p].tables[order / partition_count_];
+    std::uint32_t first = order_first_items_[order];
+    std::uint32_t last = order_first_items_[order + 1];
+    for (; table.stage < kStageCount; ++table.stage) {
+        std::uint32_t fired = 0;
+        for (std::uint32_t item = first; item < last; ++item) {
+            if (stage_[(*items_)[item]] == table.stage) {
+                send(p, lineOf(item) % partition_count_, {now + options_.handoff_time, item, Event::FIRE});
+                ++fired;
+            }
+        }
+        if (fired > 0) {
+            table.remaining = fired;
+            return;
+        }
+    }
+}
+
+void Simulation::startItem(std::size_t p, LineState& line, std::uint32_t item, Time fired, Time now) {
+    Partition& partition = partitions_[p];
+    std::uint32_t menu_index = (*items_)[item];
+    KitchenSimulation::StationStats& stats = partition.stations[static_cast<std::size_t>(station_[menu_index])];
+    ++line.busy;
+    ++stats.cooked;
+    stats.busy_time += prep_time_[menu_index];
+    stats.total_wait += now - fired;
+    send(p, p, {now + prep_time_[menu_index], item, Event::DONE});
+}
@@ -0,0 +1,152 @@
+/**
+ * @file KitchenSimulation.hpp
+ * @brief This file contains the declaration of the KitchenSimulation class, a discrete-event simulation of a kitchen serving a Menu.
+ *
+ * Each table order arrives at a given time with a list of menu items. The items of one course are fired
+ * together: the appetizers when the order arrives, the main courses (and plain dishes) once every appetizer
+ * of the table has been served, the desserts once every main course has been served. A fired item goes to
+ * a line of the station that cooks it (see stationOf()), waits there for a free cook and is done after its
+ * preparation time. Every step from the pass to a station and back takes Options::handoff_time.
+ *
+ * The tables and the station lines are split across Options::thread_count threads. Each thread runs its
+ * own event queue; events for another thread are exchanged in time windows of length handoff_time, which
+ * no event can cross, so the threads only synchronize once per window. Ties between events are broken by
+ * event kind and id rather than by arrival order, so a run gives the same Report for any thread count.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef KITCHEN_SIMULATION_HPP
+#define KITCHEN_SIMULATION_HPP
+
+#include "ArrayView.hpp"
+#include "Menu.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class KitchenSimulation {
+public:
+    // Time type definition, simulated seconds
+    using Time = std::int64_t;
+
+    // Station enum definition, the part of the kitchen an item is cooked at
+    enum class Station : std::uint8_t { LINE, COLD, GRILL, OVEN, FRYER, STEAMER, PASTRY };
+    static constexpr std::size_t kStationCount = 7;
+
+    struct Options {
+        unsigned lines[kStationCount] = {1, 1, 1, 1, 1, 1, 1};  // independent queues per station
+        unsigned cooks_per_line = 2;                           // items a line cooks at the same time
+        Time handoff_time = 30;                                // pass to station and back, at least 1
+        unsigned thread_count = 1;
+    };
+
+    struct DishStats {
+        std::size_t served = 0;
+        double mean_latency = 0.0;                  // from the arrival of the order to the item being served
+        Time p50_latency = 0;
+        Time p90_latency = 0;
+        Time p99_latency = 0;
+        Time max_latency = 0;
+    };
+
+    struct StationStats {
+        std::size_t cooked = 0;
+        Time busy_time = 0;                         // summed over every cook of every line
+        Time total_wait = 0;                        // time items spent queued before a cook took them
+        std::size_t max_queue = 0;                  // longest queue of a single line
+        double utilization = 0.0;                   // busy_time over the capacity of the station until the end
+    };
+
+    struct Report {
+        Time end_time = 0;                          // the time the last item was served
+        std::size_t orders = 0;
+        std::size_t items = 0;
+        std::size_t events = 0;
+        std::size_t windows = 0;                    // synchronization rounds between the threads
+        std::vector<DishStats> dishes;              // by menu index
+        StationStats stations[kStationCount];
+    };
+
+    /**
+     * Parameterized constructor.
+     * @param menu A reference to the menu the orders refer to, which must outlive the simulation.
+     */
+    explicit KitchenSimulation(const Menu& menu);
+
+    /**
+     * Parameterized constructor.
+     * @param menu A reference to the menu the orders refer to, which must outlive the simulation.
+     * @param options The station layout, the handoff time and the number of threads.
+     */
+    KitchenSimulation(const Menu& menu, const Options& options);
+
+    /**
+     * Reserves room for orders.
+     * @param orders The number of orders.
+     * @param items The total number of items over those orders.
+     */
+    void reserve(std::size_t orders, std::size_t items);
+
+    /**
+     * Adds a table order. Orders may be added in any order of arrival.
+     * @param arrival The time the order arrives at the pass, not negative.
+     * @param menu_items The menu indexes of the items, one entry per plate.
+     * @param error Set to a description of the problem if the order is rejected.
+     * @return True if the order was added, false otherwise.
+     */
+    bool addOrder(Time arrival, ArrayView<std::uint32_t> menu_items, std::string& error);
+
+    /**
+     * @return The number of orders added.
+     */
+    std::size_t orderCount() const;
+
+    /**
+     * Simulates every order. The simulation can be run again, for example with other options.
+     * @param report Set to the latencies per menu item and the load per station.
+     * @param error Set to a description of the problem if the options are invalid.
+     * @return True if the simulation ran, false otherwise.
+     */
+    bool run(Report& report, std::string& error) const;
+
+    /**
+     * @return The options of the next run.
+     */
+    const Options& options() const;
+
+    /**
+     * @param options The options of the next run.
+     */
+    void setOptions(const Options& options);
+
+    /**
+     * @param item A menu item.
+     * @return The station that cooks it: main courses by cooking method (RAW ones at COLD), appetizers at
+     * COLD, desserts at PASTRY and plain dishes at LINE.
+     */
+    static Station stationOf(const Menu::Item& item);
+
+    /**
+     * @param station A station.
+     * @return The name of the station, e.g. "GRILL".
+     */
+    static std::string_view stationName(Station station);
+
+private:
+    struct Order {
+        Time arrival;
+        std::uint32_t first_item;                   // position of the first item in items_
+        std::uint32_t item_count;
+    };
+
+    const Menu& menu_;
+    Options options_;
+    std::vector<Order> orders_;
+    std::vector<std::uint32_t> items_;              // menu indexes, the items of each order are contiguous
+};
+
+#endif // KITCHEN_SIMULATION_HPP
@@ -10,6 +10,9 @@
  */
 
 #include "MainCourse.hpp"
+#include "DishInstrumentation.hpp"
+#include "MenuRenderer.hpp"
+#include <utility> // For std::move
 
 /**
 * Default constructor with inheritence from Dish default constructor.
@@ -19,17 +22,13 @@
 * - side_dishes_: Empty list
 * - gluten_free_: False
 */
-MainCourse::MainCourse() : Dish()
+MainCourse::MainCourse() : MainCourse(allocator_type())
 {
-    this->cooking_method_ = GRILLED;
-    this->protein_type_ = "UNKNOWN";
-    this->side_dishes_ = {};
-    this->gluten_free_ = false;
 }
 
 /**
 * Parameterized constructor of MainCourse with inheritance from Dish parameterized constructor.
-* @param name A reference to the name of the dish.
+* @param name The name of the dish, copied into the dish's memory resource.
 * @param ingredients A reference to a list of ingredients (default is
 empty list).
 * @param prep_time The preparation time in minutes (default is 0).
@@ -37,30 +36,123 @@ empty list).
 * @param cuisine_type The cuisine type of the dish (a CuisineType enum)
 with default value OTHER.
 * @param cooking_method The cooking method of the main course (a CookingMethod enum)
-* @param protein_type A reference to the protein type of the main course
-* @param side_dishes A struct containing the name and category of the side dish.  
+* @param protein_type The protein type of the main course, copied into the dish's memory resource
+* @param side_dishes A reference to a list of side dishes (name and category), their names are interned in SymbolTable::sideDishes()
 * @param gluten_free A reference to whether the main course is gluten free
-Accessors and Mutators:
+* @param alloc The allocator the dish takes its memory from (default is
+the default memory resource).
 * @post The private members are set to the values of the corresponding
 parameters.
 */
-MainCourse::MainCourse(const std::string& name, const std::vector<std::string>& ingredients, const int& prep_time, const double& price, const CuisineType cuisine_type, const CookingMethod cooking_method, const std::string& protein_type, const std::vector<SideDish>& side_dishes, const bool& gluten_free) : Dish(name, ingredients, prep_time, price, cuisine_type)
+MainCourse::MainCourse(std::string_view name, const std::vector<std::string>& ingredients, const int& prep_time, const double& price, const CuisineType cuisine_type, const CookingMethod cooking_method, std::string_view protein_type, const std::vector<SideDish>& side_dishes, const bool& gluten_free, const allocator_type& alloc)
+    : Dish(name, ingredients, prep_time, price, cuisine_type, alloc), protein_type_(protein_type, alloc), side_dishes_(alloc)
 {
-    cooking_method_ = cooking_method;
-    protein_type_ = protein_type;
-    side_dishes_ = side_dishes;
-    gluten_free_ = gluten_free;
+    setCourse(Course::MAIN_COURSE);
+    setStyle(cooking_method);
+    setFlag(kGlutenFreeFlag, gluten_free);
+    side_dishes_.reserve(side_dishes.size());
+    for (const SideDish& side_dish : side_dishes) {
+        appendSideDish(side_dish.name, side_dish.category);
+    }
+    DISH_COUNT(MAIN_COURSE, CONSTRUCTIONS);
+    DISH_COUNT_HEAP(MAIN_COURSE, protein_type_);
+    DISH_COUNT_HEAP(MAIN_COURSE, side_dishes_);
+}
+
+/**
+* Default constructor with a memory resource.
+* @param alloc The allocator the main course takes its memory from.
+* @post The private members are set to the same values as the default
+constructor.
+*/
+MainCourse::MainCourse(const allocator_type& alloc) : Dish(alloc), protein_type_("UNKNOWN", alloc), side_dishes_(alloc)
+{
+    setCourse(Course::MAIN_COURSE);
+    setStyle(GRILLED);
+    DISH_COUNT(MAIN_COURSE, CONSTRUCTIONS);
+}
+
+/**
+* Copy constructor.
+* @param other A reference to the main course to copy.
+* @param alloc The allocator the copy takes its memory from (default is
+the default memory resource).
+*/
+MainCourse::MainCourse(const MainCourse& other, const allocator_type& alloc)
+    : Dish(other, alloc), protein_type_(other.protein_type_, alloc), side_dishes_(other.side_dishes_, alloc)
+{
+    assignAttributes(other);
+    DISH_COUNT(MAIN_COURSE, COPIES);
+    DISH_COUNT_HEAP(MAIN_COURSE, protein_type_);
+    DISH_COUNT_HEAP(MAIN_COURSE, side_dishes_);
+}
+
+/**
+* Move constructor, the new main course keeps the memory resource of `other`.
+* @param other The main course to move from.
+*/
+MainCourse::MainCourse(MainCourse&& other) noexcept : Dish(std::move(other)), protein_type_(std::move(other.protein_type_)), side_dishes_(std::move(other.side_dishes_))
+{
+    assignAttributes(other);
+    DISH_COUNT(MAIN_COURSE, MOVES);
+}
+
+/**
+* Move constructor with a memory resource.
+* @param other The main course to move from.
+* @param alloc The allocator of the new main course, the members are
+copied if it differs from the one of `other`.
+*/
+MainCourse::MainCourse(MainCourse&& other, const allocator_type& alloc)
+    : Dish(std::move(other), alloc), protein_type_(std::move(other.protein_type_), alloc), side_dishes_(std::move(other.side_dishes_), alloc)
+{
+    assignAttributes(other);
+    DISH_COUNT(MAIN_COURSE, MOVES);
+}
+
+/**
+* Copy assignment operator.
+* @param other A reference to the main course to copy.
+* @return A reference to this main course.
+*/
+MainCourse& MainCourse::operator=(const MainCourse& other)
+{
+    Change change(*this, DishObserver::Field::ALL);
+    assignDish(other);
+    assignAttributes(other);
+    protein_type_ = other.protein_type_;
+    side_dishes_ = other.side_dishes_;
+    DISH_COUNT(MAIN_COURSE, COPIES);
+    return *this;
+}
+
+/**
+* Move assignment operator.
+* @param other The main course to move from.
+* @return A reference to this main course.
+*/
+MainCourse& MainCourse::operator=(MainCourse&& other)
+{
+    Change change(*this, DishObserver::Field::ALL);
+    Change source_change(other, DishObserver::Field::ALL);
+    assignDish(std::move(other));
+    assignAttributes(other);
+    protein_type_ = std::move(other.protein_type_);
+    side_dishes_ = std::move(other.side_dishes_);
+    DISH_COUNT(MAIN_COURSE, MOVES);
+    return *this;
 }
 
 /**
  * Sets the cooking method of the main course.
  * @param cooking_method The new cooking method.
- * @post Sets the private member `cooking_method_` to the value of the
+ * @post Sets the style bits of the attribute word to the value of the
 parameter.
  */
 void MainCourse::setCookingMethod(const CookingMethod cooking_method)
 {
-    this->cooking_method_ = cooking_method;
+    Change change(*this, DishObserver::Field::COOKING_METHOD);
+    setStyle(cooking_method);
 }
 
 /**
@@ -68,7 +160,7 @@ void MainCourse::setCookingMethod(const CookingMethod cooking_method)
  */
 MainCourse::CookingMethod MainCourse::getCookingMethod() const
 {
-    return cooking_method_;
+    return static_cast<CookingMethod>(getStyle());
 }
 
 /**
@@ -77,28 +169,54 @@ MainCourse::CookingMethod MainCourse::getCookingMethod() const
  * @post Sets the private member `protein_type_` to the value of the
 parameter.
  */
-void MainCourse::setProteinType(const std::string& protein_type)
+void MainCourse::setProteinType(std::string_view protein_type)
 {
-    this->protein_type_ = protein_type;   
+    Change change(*this, DishObserver::Field::PROTEIN_TYPE);
+    this->protein_type_ = protein_type;
 }
 
 /**
  * @return The type of protein in the main course.
  */
 std::string MainCourse::getProteinType() const
+{
+    std::string protein_type(protein_type_.data(), protein_type_.size());
+    DISH_COUNT(GET_PROTEIN_TYPE, CALLS);
+    DISH_COUNT_HEAP(GET_PROTEIN_TYPE, protein_type);
+    return protein_type;
+}
+
+/**
+ * @return A view of the type of protein in the main course, valid until
+the protein type is changed or the main course is moved or destroyed.
+ */
+std::string_view MainCourse::getProteinTypeView() const
 {
     return protein_type_;
 }
 
 /**
  * Adds a side dish to the main course.
- * @param side_dish A SideDish struct containing the name and category
-of the side dish.
- * @post Adds the side dish to the `side_dishes_` vector.
+ * @param side_dish A reference to a SideDish struct containing the name and
+category of the side dish, its name is interned in SymbolTable::sideDishes().
+ * @post Adds the side dish to the `side_dishes_` list.
+ */
+void MainCourse::addSideDish(const SideDish& side_dish)
+{
+    Change change(*this, DishObserver::Field::SIDE_DISHES);
+    appendSideDish(side_dish.name, side_dish.category);
+}
+
+/**
+ * Adds a side dish to the main course without building a SideDish.
+ * @param name The name of the side dish, interned in SymbolTable::sideDishes().
+ * @param category The category of the side dish.
+ * @post Adds the side dish to the `side_dishes_` list.
  */
-void MainCourse::addSideDish(const SideDish& side_dishes)
+void MainCourse::emplaceSideDish(std::string_view name, Category category)
 {
-    side_dishes_.push_back(side_dishes);
+    Change change(*this, DishObserver::Field::SIDE_DISHES);
+    appendSideDish(name, category);
 }
 
 /**
@@ -107,19 +225,85 @@ served with the main course.
  */
 std::vector<MainCourse::SideDish> MainCourse::getSideDishes() const
 {
-    return side_dishes_;
+    const SymbolTable& table = SymbolTable::sideDishes();
+    std::vector<SideDish> side_dishes;
+    side_dishes.reserve(side_dishes_.size());
+    for (const PackedSideDish& side_dish : side_dishes_) {
+        side_dishes.push_back(SideDish{table.name(side_dish.name_id), side_dish.category});
+        DISH_COUNT_HEAP(GET_SIDE_DISHES, side_dishes.back().name);
+    }
+    DISH_COUNT(GET_SIDE_DISHES, CALLS);
+    DISH_COUNT_HEAP(GET_SIDE_DISHES, side_dishes);
+    DISH_COUNT_N(SIDE_DISH, CONSTRUCTIONS, side_dishes.size());
+    return side_dishes;
+}
+
+/**
+ * @return The number of side dishes served with the main course.
+ */
+std::size_t MainCourse::getSideDishCount() const
+{
+    return side_dishes_.size();
+}
+
+/**
+ * @param i The position of the side dish, must be less than getSideDishCount().
+ * @return A view of the name of the side dish at position i, valid for the
+lifetime of the program.
+ */
+std::string_view MainCourse::getSideDishNameView(std::size_t i) const
+{
+    return SymbolTable::sideDishes().name(side_dishes_[i].name_id);
+}
+
+/**
+ * @param i The position of the side dish, must be less than getSideDishCount().
+ * @return The category of the side dish at position i.
+ */
+MainCourse::Category MainCourse::getSideDishCategory(std::size_t i) const
+{
+    return side_dishes_[i].category;
+}
+
+/**
+ * @return A view of the packed side dishes, valid until a side dish is
+added or the main course is moved or destroyed.
+ */
+ArrayView<MainCourse::PackedSideDish> MainCourse::getPackedSideDishesView() const
+{
+    return ArrayView<PackedSideDish>(side_dishes_);
+}
+
+/**
+ * @return The categories of the side dishes served with the main course,
+one bit per category (see sideDishCategoryBit()).
+ */
+std::uint32_t MainCourse::getSideDishCategories() const
+{
+    return (getAttributes() & kSideDishCategoryMask) >> kSideDishCategoryShift;
+}
+
+/**
+ * @param category A side dish category.
+ * @return True if a side dish of the category is served with the main
+course, false otherwise.
+ */
+bool MainCourse::hasSideDishCategory(Category category) const
+{
+    return (getSideDishCategories() & sideDishCategoryBit(category)) != 0;
 }
 
 /**
  * Sets the gluten-free flag of the main course.
  * @param gluten_free A boolean indicating if the main course is gluten-
 free.
- * @post Sets the private member `gluten_free_` to the value of the
+ * @post Sets the gluten-free flag of the attribute word to the value of the
 parameter.
  */
 void MainCourse::setGlutenFree(const bool& gluten_free)
 {
-    this->gluten_free_ = gluten_free;
+    Change change(*this, DishObserver::Field::GLUTEN_FREE);
+    setFlag(kGlutenFreeFlag, gluten_free);
 }
 
 /**
@@ -127,7 +311,14 @@ void MainCourse::setGlutenFree(const bool& gluten_free)
  */
 bool MainCourse::isGlutenFree() const
 {
-    return this->gluten_free_;
+    return getFlag(kGlutenFreeFlag);
+}
+
+// Helper function to intern a side dish and record its category
+void MainCourse::appendSideDish(std::string_view name, Category category)
+{
+    side_dishes_.push_back(PackedSideDish{SymbolTable::sideDishes().intern(name), category});
+    setFlag(sideDishCategoryBit(category) << kSideDishCategoryShift, true);
 }
 
     // Helper function to display outputs
@@ -136,83 +327,8 @@ bool MainCourse::isGlutenFree() const
      */
 void MainCourse::displayMainCourse() const
 {
-    std::cout << "Cooking Method: ";
-    if (cooking_method_ == 0)
-    {
-        std::cout << "GRILLED" << std::endl;
-    }
-    if (cooking_method_ == 1)
-    {
-        std::cout << "BAKED" << std::endl;
-    }
-    if (cooking_method_ == 2)
-    {
-        std::cout << "FRIEND" << std::endl;
-    }
-    if (cooking_method_ == 2)
-    {
-        std::cout << "STEAMED" << std::endl;
-    }
-    if (cooking_method_ == 3)
-    {
-        std::cout << "RAW" << std::endl;
-    }
-
-    std::cout << "Protein Type: " << getProteinType() << std::endl;
-
-    std::vector<MainCourse::SideDish> side_dishes = getSideDishes();
-    std::cout << "Side Dishes: ";
-    for (size_t i = 0; i < side_dishes.size(); i++)
-    {
-        std::cout << side_dishes[i].name;
-        if (side_dishes[i].category == GRAIN)
-        {
-            std::cout << " (Grain)";
-        }
-            if (side_dishes[i].category == PASTA)
-        {
-            std::cout << " (Pasta)";
-        }
-        if (side_dishes[i].category == LEGUME)
-        {
-            std::cout << " (Legume)";
-        }
-        if (side_dishes[i].category == BREAD)
-        {
-            std::cout << " (Bread)";
-        }
-        if (side_dishes[i].category == SALAD)
-        {
-            std::cout << " (Salad)";
-        }
-        if (side_dishes[i].category == SOUP)
-        {
-            std::cout << " (Soup)";
-        }
-        if (side_dishes[i].category == STARCHES)
-        {
-            std::cout << " (Starches)";
-        }
-        if (side_dishes[i].category == VEGETABLE)
-        {
-            std::cout << " (Vegetable)";
-        }
-
-        if (i < side_dishes.size() - 1)
-        {
-            std::cout << ", ";
-        }
-    }
-
-    std::cout << std::endl;
-
-    std::cout << "Gluten-Free: ";
-    if (isGlutenFree() == 1)
-    {
-        std::cout << "True" << std::endl;
-    }
-    else
-    {
-        std::cout << "False" << std::endl;
-    }
+    OStreamSink sink(std::cout);
+    MenuRenderer renderer(sink);
+    renderer.renderMainCourse(*this);
+    renderer.flush();
 }
\ No newline at end of file
@@ -5,6 +5,11 @@
  * The MainCourse class includes attributes such as cooking method, protein type, side dishes with category, and whether it is gluten free.
  * It provides constructors, accessor and mutator functions, and a display function to manage and present
  * the details of a main course.
+ *
+ * Side dishes are stored packed: the name is interned in SymbolTable::sideDishes() and only its id is kept
+ * next to the category, so the usual few side dishes fit inline. The categories served are also kept as a
+ * bitmask in the attribute word (Dish::kSideDishCategoryMask), so "served with a SALAD or VEGETABLE side"
+ * is one mask test on a dish or on a DishCatalog column (see DishFilter::sideDishCategoryAny()).
  * 
  * @date September 17th, 2024
  * @author Kun Feng Wei
@@ -14,8 +19,12 @@
 #define MAIN_COURSE_HPP
 
 #include "Dish.hpp"
+#include "ArrayView.hpp"
+#include "SymbolTable.hpp"
+#include <cstdint>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <iomanip> // For std::fixed and std::setprecision
 #include <cctype>  // For std::isalpha, std::isspace
@@ -33,6 +42,29 @@ public:
         Category category;
     };
 
+    // PackedSideDish definition, the stored form of a side dish
+    struct PackedSideDish
+    {
+        SymbolTable::Id name_id;    // see SymbolTable::sideDishes()
+        Category category;
+    };
+
+    // Side dish list type definition, up to kInlineSideDishes side dishes are stored inline. A Menu::Item is
+    // as large as a MainCourse, so each inline side dish is paid by every item of a menu
+    static constexpr std::size_t kInlineSideDishes = 3;
+    using SideDishes = SmallVector<PackedSideDish, kInlineSideDishes>;
+
+/**
+ * @param category A side dish category.
+ * @return The bit of the category in the masks of getSideDishCategories(), 1 << category. The category is
+masked to the 8 bits of the mask, so a value outside the enum cannot reach other fields of the attribute word.
+ */
+    static constexpr std::uint32_t sideDishCategoryBit(Category category)
+    {
+        static_assert(VEGETABLE < 8, "side dish categories must fit the 8-bit category mask");
+        return 1u << (static_cast<unsigned>(category) & 7u);
+    }
+
 /**
 * Default constructor with inheritence from Dish default constructor.
 * Initializes all private members with default values:
@@ -45,7 +77,7 @@ public:
 
 /**
 * Parameterized constructor of MainCourse with inheritance from Dish parameterized constructor.
-* @param name A reference to the name of the dish.
+* @param name The name of the dish, copied into the dish's memory resource.
 * @param ingredients A reference to a list of ingredients (default is
 empty list).
 * @param prep_time The preparation time in minutes (default is 0).
@@ -53,18 +85,56 @@ empty list).
 * @param cuisine_type The cuisine type of the dish (a CuisineType enum)
 with default value OTHER.
 * @param cooking_method The cooking method of the main course (a CookingMethod enum)
-* @param protein_type A reference to the protein type of the main course
-* @param side_dishes A struct containing the name and category of the side dish.  
+* @param protein_type The protein type of the main course, copied into the dish's memory resource
+* @param side_dishes A reference to a list of side dishes (name and category), their names are interned in SymbolTable::sideDishes()
 * @param gluten_free A reference to whether the main course is gluten free
-Accessors and Mutators:
+* @param alloc The allocator the dish takes its memory from (default is
+the default memory resource).
 * @post The private members are set to the values of the corresponding
 parameters.
 */
-    MainCourse(const std::string& name, const std::vector<std::string>& ingredients, const int& prep_time, const double& price, const CuisineType cuisine_type, const CookingMethod cooking_method, const std::string& protein_type, const std::vector<SideDish>& side_dishes_, const bool& gluten_free);
+    MainCourse(std::string_view name, const std::vector<std::string>& ingredients, const int& prep_time, const double& price, const CuisineType cuisine_type, const CookingMethod cooking_method, std::string_view protein_type, const std::vector<SideDish>& side_dishes, const bool& gluten_free, const allocator_type& alloc = {});
+
+/**
+* Default constructor with a memory resource.
+* @param alloc The allocator the main course takes its memory from.
+* @post The private members are set to the same values as the default
+constructor.
+*/
+    explicit MainCourse(const allocator_type& alloc);
+
+/**
+* Copy constructor.
+* @param other A reference to the main course to copy.
+* @param alloc The allocator the copy takes its memory from (default is
+the default memory resource).
+*/
+    MainCourse(const MainCourse& other, const allocator_type& alloc = {});
+
+/**
+* Move constructor, the new main course keeps the memory resource of `other`.
+*/
+    MainCourse(MainCourse&& other) noexcept;
+
+/**
+* Move constructor with a memory resource.
+* @param other The main course to move from.
+* @param alloc The allocator of the new main course, the members are
+copied if it differs from the one of `other`.
+*/
+    MainCourse(MainCourse&& other, const allocator_type& alloc);
+
+/**
+* Assignment operators. Each main course keeps its own observer, which sees the
+assignment as a change of ALL fields.
+*/
+    MainCourse& operator=(const MainCourse& other);
+    MainCourse& operator=(MainCourse&& other);
+
 /**
  * Sets the cooking method of the main course.
  * @param cooking_method The new cooking method.
- * @post Sets the private member `cooking_method_` to the value of the
+ * @post Sets the style bits of the attribute word to the value of the
 parameter.
  */
     void setCookingMethod(CookingMethod cooking_method_);
@@ -80,20 +150,34 @@ parameter.
  * @post Sets the private member `protein_type_` to the value of the
 parameter.
  */
-    void setProteinType(const std::string& protein_type_);
+    void setProteinType(std::string_view protein_type);
 
 /**
  * @return The type of protein in the main course.
  */
     std::string getProteinType() const;
 
+/**
+ * @return A view of the type of protein in the main course, valid until
+the protein type is changed or the main course is moved or destroyed.
+ */
+    std::string_view getProteinTypeView() const;
+
 /**
  * Adds a side dish to the main course.
- * @param side_dish A SideDish struct containing the name and category
-of the side dish.
- * @post Adds the side dish to the `side_dishes_` vector.
+ * @param side_dish A reference to a SideDish struct containing the name and
+category of the side dish, its name is interned in SymbolTable::sideDishes().
+ * @post Adds the side dish to the `side_dishes_` list.
  */
-    void addSideDish(const SideDish& side_dishes_);
+    void addSideDish(const SideDish& side_dish);
+
+/**
+ * Adds a side dish to the main course without building a SideDish.
+ * @param name The name of the side dish, interned in SymbolTable::sideDishes().
+ * @param category The category of the side dish.
+ * @post Adds the side dish to the `side_dishes_` list.
+ */
+    void emplaceSideDish(std::string_view name, Category category);
 
 /**
  * @return A vector of SideDish structs representing the side dishes
@@ -101,11 +185,48 @@ served with the main course.
  */
     std::vector<SideDish> getSideDishes() const;
 
+/**
+ * @return The number of side dishes served with the main course.
+ */
+    std::size_t getSideDishCount() const;
+
+/**
+ * @param i The position of the side dish, must be less than getSideDishCount().
+ * @return A view of the name of the side dish at position i, valid for the
+lifetime of the program.
+ */
+    std::string_view getSideDishNameView(std::size_t i) const;
+
+/**
+ * @param i The position of the side dish, must be less than getSideDishCount().
+ * @return The category of the side dish at position i.
+ */
+    Category getSideDishCategory(std::size_t i) const;
+
+/**
+ * @return A view of the packed side dishes, valid until a side dish is
+added or the main course is moved or destroyed.
+ */
+    ArrayView<PackedSideDish> getPackedSideDishesView() const;
+
+/**
+ * @return The categories of the side dishes served with the main course,
+one bit per category (see sideDishCategoryBit()).
+ */
+    std::uint32_t getSideDishCategories() const;
+
+/**
+ * @param category A side dish category.
+ * @return True if a side dish of the category is served with the main
+course, false otherwise.
+ */
+    bool hasSideDishCategory(Category category) const;
+
 /**
  * Sets the gluten-free flag of the main course.
  * @param gluten_free A boolean indicating if the main course is gluten-
 free.
- * @post Sets the private member `gluten_free_` to the value of the
+ * @post Sets the gluten-free flag of the attribute word to the value of the
 parameter.
  */
     void setGlutenFree(const bool& gluten_free_);
@@ -122,10 +243,11 @@ parameter.
     void displayMainCourse() const;
 
 private:
-    CookingMethod cooking_method_;
-    std::string protein_type_;
-    std::vector<SideDish> side_dishes_;
-    bool gluten_free_;
+    // Helper function to intern a side dish and record its category
+    void appendSideDish(std::string_view name, Category category);
+
+    std::pmr::string protein_type_;  // the cooking method and gluten-free flag live in the attribute word
+    SideDishes side_dishes_;
 };
 
 #endif // MAIN_COURSE_HPP
@@ -0,0 +1,108 @@
+/**
+ * @file Menu.cpp
+ * @brief This file contains the implementation of the Menu class.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "Menu.hpp"
+#include <type_traits>
+
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(Dish::Course::APPETIZER), Menu::Item>, Appetizer> &&
+              std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(Dish::Course::MAIN_COURSE), Menu::Item>, MainCourse> &&
+              std::is_same_v<std::variant_alternative_t<static_cast<std::size_t>(Dish::Course::DESSERT), Menu::Item>, Dessert>,
+              "Menu::Item alternatives must follow the order of Dish::Course");
+
+// Summary Functions
+double Menu::Summary::averagePrice() const {
+    return count == 0 ? 0.0 : total_price / static_cast<double>(count);
+}
+
+// Constructor
+Menu::Menu() {
+}
+
+void Menu::reserve(std::size_t items) {
+    items_.reserve(items);
+}
+
+// Insertion Functions
+std::size_t Menu::add(Dish dish) {
+    items_.emplace_back(std::in_place_type<Dish>, std::move(dish));
+    return items_.size() - 1;
+}
+
+std::size_t Menu::add(Appetizer appetizer) {
+    items_.emplace_back(std::in_place_type<Appetizer>, std::move(appetizer));
+    return items_.size() - 1;
+}
+
+std::size_t Menu::add(MainCourse main_course) {
+    items_.emplace_back(std::in_place_type<MainCourse>, std::move(main_course));
+    return items_.size() - 1;
+}
+
+std::size_t Menu::add(Dessert dessert) {
+    items_.emplace_back(std::in_place_type<Dessert>, std::move(dessert));
+    return items_.size() - 1;
+}
+
+void Menu::clear() {
+    items_.clear();
+}
+
+// Accessor Functions
+std::size_t Menu::size() const {
+    return items_.size();
+}
+
+bool Menu::empty() const {
+    return items_.empty();
+}
+
+const Menu::Item& Menu::operator[](std::size_t index) const {
+    return items_[index];
+}
+
+Menu::Item& Menu::operator[](std::size_t index) {
+    return items_[index];
+}
+
+const Dish& Menu::dish(const Item& item) {
+    return std::visit([](const Dish& dish) -> const Dish& { return dish; }, item);
+}
+
+Dish::Course Menu::course(const Item& item) {
+    return static_cast<Dish::Course>(item.index());
+}
+
+// Algorithms
+std::vector<std::size_t> Menu::select(const AttributeFilter& filter) const {
+    std::vector<std::size_t> indexes;
+    for (std::size_t i = 0; i < items_.size(); ++i) {
+        if (filter.matches(dish(items_[i]))) {
+            indexes.push_back(i);
+        }
+    }
+    return indexes;
+}
+
+Menu::Summary Menu::summarize() const {
+    Summary summary = {0, {0, 0, 0, 0}, 0.0, 0.0, 0.0, 0};
+    for (const Item& item : items_) {
+        const Dish& base = dish(item);
+        double price = base.getPrice();
+        if (summary.count == 0 || price < summary.min_price) {
+            summary.min_price = price;
+        }
+        if (summary.count == 0 || price > summary.max_price) {
+            summary.max_price = price;
+        }
+        ++summary.count;
+        ++summary.course_counts[item.index()];
+        summary.total_price += price;
+        summary.total_prep_time += base.getPrepTime();
+    }
+    return summary;
+}
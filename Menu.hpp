@@ -0,0 +1,177 @@
+/**
+ * @file Menu.hpp
+ * @brief This file contains the declaration of the Menu class, a heterogeneous container of dishes stored by value.
+ *
+ * A Menu holds plain dishes, appetizers, main courses and desserts in one contiguous vector of
+ * std::variant items, so a mixed menu keeps every field of every class without slicing and without a
+ * separate allocation per dish. The classes of the Dish hierarchy have no virtual functions; algorithms
+ * over a Menu dispatch on the variant index instead (see visit()), which the compiler turns into a jump
+ * table over a closed set of classes.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef MENU_HPP
+#define MENU_HPP
+
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include "AttributeFilter.hpp"
+#include <cstddef>
+#include <utility>
+#include <variant>
+#include <vector>
+
+class Menu {
+public:
+    // Item type definition, the alternatives are in the order of Dish::Course
+    using Item = std::variant<Dish, Appetizer, MainCourse, Dessert>;
+
+    // Summary definition, the result of summarize()
+    struct Summary {
+        std::size_t count;
+        std::size_t course_counts[4];   // by Dish::Course
+        double total_price;
+        double min_price;               // 0 for an empty menu
+        double max_price;               // 0 for an empty menu
+        long total_prep_time;
+
+        /**
+         * @return The average price, 0 for an empty menu.
+         */
+        double averagePrice() const;
+    };
+
+    /**
+     * Default constructor.
+     * Creates an empty menu.
+     */
+    Menu();
+
+    /**
+     * Reserves room for items.
+     * @param items The number of items the menu should hold without reallocating.
+     */
+    void reserve(std::size_t items);
+
+    /**
+     * Adds a dish to the end of the menu. A dish with an observer keeps it, see Dish(Dish&&).
+     * @param dish The dish to move into the menu.
+     * @return The index of the new item.
+     */
+    std::size_t add(Dish dish);
+    std::size_t add(Appetizer appetizer);
+    std::size_t add(MainCourse main_course);
+    std::size_t add(Dessert dessert);
+
+    /**
+     * Constructs a dish in place at the end of the menu.
+     * @param args The arguments of a constructor of T.
+     * @return A reference to the new dish, valid until the menu reallocates.
+     */
+    template <typename T, typename... Args>
+    T& emplace(Args&&... args);
+
+    /**
+     * Removes every item from the menu.
+     */
+    void clear();
+
+    /**
+     * @return The number of items in the menu.
+     */
+    std::size_t size() const;
+
+    /**
+     * @return True if the menu has no items, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @param index The position of the item, must be less than size().
+     * @return A reference to the item at the given position.
+     */
+    const Item& operator[](std::size_t index) const;
+    Item& operator[](std::size_t index);
+
+    /**
+     * @param item A reference to an item.
+     * @return The Dish part of the item.
+     */
+    static const Dish& dish(const Item& item);
+
+    /**
+     * @param item A reference to an item.
+     * @return The course of the item, from the variant index.
+     */
+    static Dish::Course course(const Item& item);
+
+    // Algorithms
+    /**
+     * Calls a visitor with every item in order, as a reference to its own class.
+     * @param visitor A callable with an overload for (const) Dish&, Appetizer&, MainCourse& and Dessert&.
+     */
+    template <typename Visitor>
+    void visit(Visitor&& visitor) const;
+
+    template <typename Visitor>
+    void visit(Visitor&& visitor);
+
+    /**
+     * @param predicate A visitor returning bool for each class (see visit()).
+     * @return The indexes of the items the predicate returns true for, in increasing order.
+     */
+    template <typename Predicate>
+    std::vector<std::size_t> select(Predicate&& predicate) const;
+
+    /**
+     * @param filter A filter over the attribute word of a dish.
+     * @return The indexes of the items that pass the filter, in increasing order.
+     */
+    std::vector<std::size_t> select(const AttributeFilter& filter) const;
+
+    /**
+     * @return The item counts, price and preparation time totals of the menu.
+     */
+    Summary summarize() const;
+
+private:
+    std::vector<Item> items_;
+};
+
+// Template Functions
+template <typename T, typename... Args>
+T& Menu::emplace(Args&&... args) {
+    Item& item = items_.emplace_back(std::in_place_type<T>, std::forward<Args>(args)...);
+    return std::get<T>(item);
+}
+
+template <typename Visitor>
+void Menu::visit(Visitor&& visitor) const {
+    for (const Item& item : items_) {
+        std::visit(visitor, item);
+    }
+}
+
+template <typename Visitor>
+void Menu::visit(Visitor&& visitor) {
+    for (Item& item : items_) {
+        std::visit(visitor, item);
+    }
+}
+
+template <typename Predicate>
+std::vector<std::size_t> Menu::select(Predicate&& predicate) const {
+    std::vector<std::size_t> indexes;
+    for (std::size_t i = 0; i < items_.size(); ++i) {
+        if (std::visit(predicate, items_[i])) {
+            indexes.push_back(i);
+        }
+    }
+    return indexes;
+}
+
+#endif // MENU_HPP
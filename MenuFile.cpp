@@ -0,0 +1,427 @@
+/**
+ * @file MenuFile.cpp
+ * @brief This file contains the implementation of the MenuFileWriter and MenuFileReader classes.
+ *
+ * The writer collects the records, lists and string pool in memory and writes the sections one after the
+ * other. The reader maps the file read-only; open() checks the header and that every section lies inside
+ * the file, but it does not look at individual records. Only a file that passed verifyChecksum() is
+ * guaranteed to have consistent record offsets.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "MenuFile.hpp"
+#include <cstdio>      // For std::rename, std::remove
+#include <cstring>
+#include <fcntl.h>     // For open
+#include <fstream>
+#include <limits>
+#include <sys/mman.h>  // For mmap, munmap
+#include <sys/stat.h>  // For fstat
+#include <unistd.h>    // For close
+
+namespace {
+
+const char kMagic[8] = {'D', 'I', 'S', 'H', 'M', 'E', 'N', 'U'};
+const std::uint32_t kByteOrderMark = 0x01020304;
+const std::uint64_t kChecksumSeed = 0x6D656E7566696C65ULL;  // "menufile"
+const std::uint64_t kChecksumMultiplier = 0x9E3779B97F4A7C15ULL;
+
+// Mixes bytes into a running checksum, 8 bytes at a time; a partial last word is padded with zeros
+std::uint64_t mixChecksum(std::uint64_t hash, const unsigned char* data, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        hash = (hash ^ word) * kChecksumMultiplier;
+        hash ^= hash >> 32;
+    }
+    if (i < size) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, data + i, size - i);
+        hash = (hash ^ word) * kChecksumMultiplier;
+        hash ^= hash >> 32;
+    }
+    return hash;
+}
+
+std::uint64_t alignTo8(std::uint64_t offset) {
+    return (offset + 7) & ~std::uint64_t(7);
+}
+
+// Checks that count elements of the given size starting at offset lie inside the file
+bool sectionFits(std::uint64_t offset, std::uint64_t count, std::uint64_t element_size, std::uint64_t file_size) {
+    if (offset % 8 != 0 || offset > file_size) {
+        return false;
+    }
+    return count <= (file_size - offset) / element_size;
+}
+
+} // namespace
+
+// Writer Functions
+MenuFileWriter::MenuFileWriter() {
+}
+
+void MenuFileWriter::add(const Dish& dish) {
+    addRecord(dish, DishCatalog::Course::DISH);
+}
+
+void MenuFileWriter::add(const Appetizer& appetizer) {
+    MenuFileRecord& record = addRecord(appetizer, DishCatalog::Course::APPETIZER);
+    record.style = static_cast<std::uint8_t>(appetizer.getServingStyle());
+    record.level = appetizer.getSpicinessLevel();
+    record.flags = appetizer.isVegetarian() ? MenuFileReader::kVegetarianFlag : 0;
+}
+
+void MenuFileWriter::add(const MainCourse& main_course) {
+    MenuFileRecord& record = addRecord(main_course, DishCatalog::Course::MAIN_COURSE);
+    record.style = static_cast<std::uint8_t>(main_course.getCookingMethod());
+    record.flags = main_course.isGlutenFree() ? MenuFileReader::kGlutenFreeFlag : 0;
+    record.protein_type = addString(main_course.getProteinTypeView());
+    for (std::size_t k = 0; k < main_course.getSideDishCount(); ++k) {
+        side_dishes_.push_back({addString(main_course.getSideDishNameView(k)),
+                                static_cast<std::uint32_t>(main_course.getSideDishCategory(k)), 0});
+    }
+    record.side_dish_count = narrow(side_dishes_.size() - record.first_side_dish, "side dish count");
+    narrow(side_dishes_.size(), "side dish list");
+}
+
+void MenuFileWriter::add(const Dessert& dessert) {
+    MenuFileRecord& record = addRecord(dessert, DishCatalog::Course::DESSERT);
+    record.style = static_cast<std::uint8_t>(dessert.getFlavorProfile());
+    record.level = dessert.getSweetnessLevel();
+    record.flags = dessert.containsNuts() ? MenuFileReader::kContainsNutsFlag : 0;
+}
+
+void MenuFileWriter::add(const DishCatalog& catalog) {
+    records_.reserve(records_.size() + catalog.size());
+    for (std::size_t i = 0; i < catalog.size(); ++i) {
+        DishCatalog::Row row = catalog[i];
+        MenuFileRecord record = {};
+        record.name = addString(row.getName());
+        record.first_ingredient = narrow(ingredients_.size(), "ingredient list");
+        record.ingredient_count = narrow(row.getIngredientCount(), "ingredient count");
+        for (std::size_t k = 0; k < row.getIngredientCount(); ++k) {
+            ingredients_.push_back(addString(row.getIngredient(k)));
+        }
+        narrow(ingredients_.size(), "ingredient list");
+        record.first_side_dish = narrow(side_dishes_.size(), "side dish list");
+        record.side_dish_count = narrow(row.getSideDishCount(), "side dish count");
+        for (std::size_t k = 0; k < row.getSideDishCount(); ++k) {
+            side_dishes_.push_back({addString(row.getSideDishName(k)), static_cast<std::uint32_t>(row.getSideDishCategory(k)), 0});
+        }
+        narrow(side_dishes_.size(), "side dish list");
+        record.price = row.getPrice();
+        record.prep_time = row.getPrepTime();
+        record.course = static_cast<std::uint8_t>(row.getCourse());
+        record.cuisine_type = static_cast<std::uint8_t>(row.getCuisineTypeEnum());
+
+        switch (row.getCourse()) {
+            case DishCatalog::Course::APPETIZER:
+                record.style = static_cast<std::uint8_t>(row.getServingStyle());
+                record.level = row.getSpicinessLevel();
+                record.flags = row.isVegetarian() ? MenuFileReader::kVegetarianFlag : 0;
+                break;
+            case DishCatalog::Course::MAIN_COURSE:
+                record.style = static_cast<std::uint8_t>(row.getCookingMethod());
+                record.flags = row.isGlutenFree() ? MenuFileReader::kGlutenFreeFlag : 0;
+                record.protein_type = addString(row.getProteinType());
+                break;
+            case DishCatalog::Course::DESSERT:
+                record.style = static_cast<std::uint8_t>(row.getFlavorProfile());
+                record.level = row.getSweetnessLevel();
+                record.flags = row.containsNuts() ? MenuFileReader::kContainsNutsFlag : 0;
+                break;
+            default:
+                break;
+        }
+        records_.push_back(record);
+    }
+}
+
+std::size_t MenuFileWriter::size() const {
+    return records_.size();
+}
+
+bool MenuFileWriter::write(const std::string& path, std::string& error) const {
+    if (!overflow_.empty()) {
+        error = "cannot write " + path + ": " + overflow_;
+        return false;
+    }
+    MenuFileHeader header = {};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = MenuFileReader::kVersion;
+    header.byte_order = kByteOrderMark;
+    header.record_count = records_.size();
+    header.records_offset = alignTo8(sizeof(MenuFileHeader));
+    header.ingredient_count = ingredients_.size();
+    header.ingredients_offset = alignTo8(header.records_offset + records_.size() * sizeof(MenuFileRecord));
+    header.side_dish_count = side_dishes_.size();
+    header.side_dishes_offset = alignTo8(header.ingredients_offset + ingredients_.size() * sizeof(MenuFileString));
+    header.strings_size = strings_.size();
+    header.strings_offset = alignTo8(header.side_dishes_offset + side_dishes_.size() * sizeof(MenuFileSideDish));
+
+    // Every section is a multiple of 8 bytes once padded, so the checksum can be computed section by section
+    std::string padding(alignTo8(strings_.size()) - strings_.size(), '\0');
+    std::uint64_t hash = kChecksumSeed;
+    hash = mixChecksum(hash, reinterpret_cast<const unsigned char*>(records_.data()), records_.size() * sizeof(MenuFileRecord));
+    hash = mixChecksum(hash, reinterpret_cast<const unsigned char*>(ingredients_.data()), ingredients_.size() * sizeof(MenuFileString));
+    hash = mixChecksum(hash, reinterpret_cast<const unsigned char*>(side_dishes_.data()), side_dishes_.size() * sizeof(MenuFileSideDish));
+    hash = mixChecksum(hash, reinterpret_cast<const unsigned char*>(strings_.data()), strings_.size());
+    header.checksum = hash;
+
+    // Write a temporary file and rename it over the old one, so a reader that has the old file mapped
+    // keeps its pages and a failed write never leaves a partial menu file behind
+    std::string temp_path = path + ".tmp";
+    std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        error = "cannot create " + temp_path;
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(records_.data()), static_cast<std::streamsize>(records_.size() * sizeof(MenuFileRecord)));
+    out.write(reinterpret_cast<const char*>(ingredients_.data()), static_cast<std::streamsize>(ingredients_.size() * sizeof(MenuFileString)));
+    out.write(reinterpret_cast<const char*>(side_dishes_.data()), static_cast<std::streamsize>(side_dishes_.size() * sizeof(MenuFileSideDish)));
+    out.write(strings_.data(), static_cast<std::streamsize>(strings_.size()));
+    out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+    out.close();
+    if (!out) {
+        std::remove(temp_path.c_str());
+        error = "cannot write " + temp_path;
+        return false;
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        error = "cannot replace " + path;
+        return false;
+    }
+    return true;
+}
+
+// Writer Helpers
+MenuFileRecord& MenuFileWriter::addRecord(const Dish& dish, DishCatalog::Course course) {
+    MenuFileRecord record = {};
+    record.name = addString(dish.getNameView());
+    record.first_ingredient = narrow(ingredients_.size(), "ingredient list");
+    record.ingredient_count = narrow(dish.getIngredientCount(), "ingredient count");
+    for (std::size_t i = 0; i < dish.getIngredientCount(); ++i) {
+        ingredients_.push_back(addString(dish.getIngredientView(i)));
+    }
+    narrow(ingredients_.size(), "ingredient list");
+    record.first_side_dish = narrow(side_dishes_.size(), "side dish list");
+    record.price = dish.getPrice();
+    record.prep_time = dish.getPrepTime();
+    record.course = static_cast<std::uint8_t>(course);
+    record.cuisine_type = static_cast<std::uint8_t>(dish.getCuisineTypeEnum());
+    records_.push_back(record);
+    return records_.back();
+}
+
+MenuFileString MenuFileWriter::addString(std::string_view text) {
+    auto found = string_index_.find(std::string(text));
+    if (found != string_index_.end()) {
+        return found->second;
+    }
+    // The end of the string has to fit as well, so the whole pool stays addressable with 32-bit offsets
+    if (strings_.size() + text.size() > std::numeric_limits<std::uint32_t>::max()) {
+        narrow(strings_.size() + text.size(), "string pool");
+        return MenuFileString{0, 0};
+    }
+    MenuFileString location = {static_cast<std::uint32_t>(strings_.size()), static_cast<std::uint32_t>(text.size())};
+    strings_.append(text.data(), text.size());
+    string_index_.emplace(std::string(text), location);
+    return location;
+}
+
+std::uint32_t MenuFileWriter::narrow(std::size_t value, const char* what) {
+    if (value > std::numeric_limits<std::uint32_t>::max()) {
+        if (overflow_.empty()) {
+            overflow_ = std::string(what) + " reached " + std::to_string(value) + ", more than a 32-bit field holds";
+        }
+        return 0;
+    }
+    return static_cast<std::uint32_t>(value);
+}
+
+// Record Functions
+MenuFileReader::Record::Record(const MenuFileReader& reader, const MenuFileRecord& record)
+    : reader_(&reader), record_(&record) {
+}
+
+DishCatalog::Course MenuFileReader::Record::getCourse() const {
+    return static_cast<DishCatalog::Course>(record_->course);
+}
+
+std::string_view MenuFileReader::Record::getNameView() const {
+    return reader_->stringAt(record_->name);
+}
+
+std::size_t MenuFileReader::Record::getIngredientCount() const {
+    return record_->ingredient_count;
+}
+
+std::string_view MenuFileReader::Record::getIngredientView(std::size_t i) const {
+    return reader_->stringAt(reader_->ingredients_[record_->first_ingredient + i]);
+}
+
+int MenuFileReader::Record::getPrepTime() const {
+    return record_->prep_time;
+}
+
+double MenuFileReader::Record::getPrice() const {
+    return record_->price;
+}
+
+Dish::CuisineType MenuFileReader::Record::getCuisineTypeEnum() const {
+    return static_cast<Dish::CuisineType>(record_->cuisine_type);
+}
+
+Appetizer::ServingStyle MenuFileReader::Record::getServingStyle() const {
+    return getCourse() == DishCatalog::Course::APPETIZER ? static_cast<Appetizer::ServingStyle>(record_->style) : Appetizer::PLATED;
+}
+
+int MenuFileReader::Record::getSpicinessLevel() const {
+    return getCourse() == DishCatalog::Course::APPETIZER ? record_->level : 0;
+}
+
+bool MenuFileReader::Record::isVegetarian() const {
+    return (record_->flags & kVegetarianFlag) != 0;
+}
+
+MainCourse::CookingMethod MenuFileReader::Record::getCookingMethod() const {
+    return getCourse() == DishCatalog::Course::MAIN_COURSE ? static_cast<MainCourse::CookingMethod>(record_->style) : MainCourse::GRILLED;
+}
+
+std::string_view MenuFileReader::Record::getProteinTypeView() const {
+    return reader_->stringAt(record_->protein_type);
+}
+
+std::size_t MenuFileReader::Record::getSideDishCount() const {
+    return record_->side_dish_count;
+}
+
+std::string_view MenuFileReader::Record::getSideDishNameView(std::size_t i) const {
+    return reader_->stringAt(reader_->side_dishes_[record_->first_side_dish + i].name);
+}
+
+MainCourse::Category MenuFileReader::Record::getSideDishCategory(std::size_t i) const {
+    return static_cast<MainCourse::Category>(reader_->side_dishes_[record_->first_side_dish + i].category);
+}
+
+bool MenuFileReader::Record::isGlutenFree() const {
+    return (record_->flags & kGlutenFreeFlag) != 0;
+}
+
+Dessert::FlavorProfile MenuFileReader::Record::getFlavorProfile() const {
+    return getCourse() == DishCatalog::Course::DESSERT ? static_cast<Dessert::FlavorProfile>(record_->style) : Dessert::SWEET;
+}
+
+int MenuFileReader::Record::getSweetnessLevel() const {
+    return getCourse() == DishCatalog::Course::DESSERT ? record_->level : 0;
+}
+
+bool MenuFileReader::Record::containsNuts() const {
+    return (record_->flags & kContainsNutsFlag) != 0;
+}
+
+// Reader Functions
+MenuFileReader::MenuFileReader()
+    : data_(nullptr), size_(0), header_(nullptr), records_(nullptr), ingredients_(nullptr), side_dishes_(nullptr), strings_(nullptr) {
+}
+
+MenuFileReader::~MenuFileReader() {
+    close();
+}
+
+bool MenuFileReader::open(const std::string& path, std::string& error, bool verify_checksum) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "cannot open " + path;
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(MenuFileHeader)) {
+        ::close(fd);
+        error = path + " is too small to be a menu file";
+        return false;
+    }
+    std::size_t size = static_cast<std::size_t>(info.st_size);
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping stays valid after the descriptor is closed
+    if (mapping == MAP_FAILED) {
+        error = "cannot map " + path;
+        return false;
+    }
+    data_ = static_cast<const unsigned char*>(mapping);
+    size_ = size;
+
+    const MenuFileHeader* header = reinterpret_cast<const MenuFileHeader*>(data_);
+    if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0) {
+        error = path + " is not a menu file";
+    } else if (header->byte_order != kByteOrderMark) {
+        error = path + " was written with a different byte order";
+    } else if (header->version != kVersion) {
+        error = path + " has unsupported version " + std::to_string(header->version);
+    } else if (!sectionFits(header->records_offset, header->record_count, sizeof(MenuFileRecord), size) ||
+               !sectionFits(header->ingredients_offset, header->ingredient_count, sizeof(MenuFileString), size) ||
+               !sectionFits(header->side_dishes_offset, header->side_dish_count, sizeof(MenuFileSideDish), size) ||
+               !sectionFits(header->strings_offset, header->strings_size, 1, size) ||
+               header->records_offset < sizeof(MenuFileHeader)) {
+        error = path + " is truncated or has a corrupt header";
+    } else {
+        header_ = header;
+        records_ = reinterpret_cast<const MenuFileRecord*>(data_ + header->records_offset);
+        ingredients_ = reinterpret_cast<const MenuFileString*>(data_ + header->ingredients_offset);
+        side_dishes_ = reinterpret_cast<const MenuFileSideDish*>(data_ + header->side_dishes_offset);
+        strings_ = reinterpret_cast<const char*>(data_ + header->strings_offset);
+        if (verify_checksum && !verifyChecksum()) {
+            error = path + " failed its checksum";
+        } else {
+            return true;
+        }
+    }
+    close();
+    return false;
+}
+
+void MenuFileReader::close() {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<unsigned char*>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    header_ = nullptr;
+    records_ = nullptr;
+    ingredients_ = nullptr;
+    side_dishes_ = nullptr;
+    strings_ = nullptr;
+}
+
+bool MenuFileReader::verifyChecksum() const {
+    if (header_ == nullptr) {
+        return false;
+    }
+    std::size_t start = header_->records_offset;
+    return checksum(data_ + start, size_ - start) == header_->checksum;
+}
+
+std::size_t MenuFileReader::size() const {
+    return header_ == nullptr ? 0 : static_cast<std::size_t>(header_->record_count);
+}
+
+MenuFileReader::Record MenuFileReader::operator[](std::size_t index) const {
+    return Record(*this, records_[index]);
+}
+
+std::uint64_t MenuFileReader::checksum(const unsigned char* data, std::size_t size) {
+    return mixChecksum(kChecksumSeed, data, size);
+}
+
+// Reader Helpers
+std::string_view MenuFileReader::stringAt(const MenuFileString& text) const {
+    return std::string_view(strings_ + text.offset, text.length);
+}
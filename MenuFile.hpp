@@ -0,0 +1,267 @@
+/**
+ * @file MenuFile.hpp
+ * @brief This file contains the declaration of the binary menu file format and its MenuFileWriter and MenuFileReader classes.
+ *
+ * A menu file stores a catalog of Dish, Appetizer, MainCourse and Dessert records with their ingredient
+ * lists and side dishes in a versioned, fixed layout that is read in place through mmap. Opening a file
+ * only maps it and checks the header; records are read straight from the mapping with no per-record
+ * parsing or allocation.
+ *
+ * File layout (native byte order, every section 8-byte aligned):
+ * - MenuFileHeader
+ * - MenuFileRecord[record_count]
+ * - MenuFileString[ingredient_count]       ingredient names of every record, in record order
+ * - MenuFileSideDish[side_dish_count]      side dishes of every main course, in record order
+ * - char[strings_size]                     string pool, each distinct string is stored once
+ *
+ * The header checksum covers every byte after the header. Offsets into the lists and the string pool are
+ * 32-bit, so the string pool and each list hold at most UINT32_MAX entries.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef MENU_FILE_HPP
+#define MENU_FILE_HPP
+
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include "DishCatalog.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// On-disk layout definitions
+struct MenuFileHeader {
+    char magic[8];                  // "DISHMENU"
+    std::uint32_t version;          // MenuFileReader::kVersion
+    std::uint32_t byte_order;       // 0x01020304 written in the byte order of the writer
+    std::uint64_t record_count;
+    std::uint64_t records_offset;
+    std::uint64_t ingredient_count;
+    std::uint64_t ingredients_offset;
+    std::uint64_t side_dish_count;
+    std::uint64_t side_dishes_offset;
+    std::uint64_t strings_size;
+    std::uint64_t strings_offset;
+    std::uint64_t checksum;
+};
+
+struct MenuFileString {
+    std::uint32_t offset;           // into the string pool
+    std::uint32_t length;
+};
+
+struct MenuFileSideDish {
+    MenuFileString name;
+    std::uint32_t category;         // MainCourse::Category
+    std::uint32_t reserved;
+};
+
+struct MenuFileRecord {
+    MenuFileString name;
+    MenuFileString protein_type;    // empty for courses other than MAIN_COURSE
+    std::uint32_t first_ingredient;
+    std::uint32_t ingredient_count;
+    std::uint32_t first_side_dish;
+    std::uint32_t side_dish_count;
+    double price;
+    std::int32_t prep_time;
+    std::int32_t level;             // spiciness level of appetizers, sweetness level of desserts
+    std::uint8_t course;            // DishCatalog::Course
+    std::uint8_t cuisine_type;      // Dish::CuisineType
+    std::uint8_t style;             // ServingStyle, CookingMethod or FlavorProfile depending on the course
+    std::uint8_t flags;             // kVegetarianFlag, kGlutenFreeFlag, kContainsNutsFlag
+    std::uint32_t reserved;
+};
+
+class MenuFileWriter {
+public:
+    /**
+     * Default constructor.
+     * Creates a writer with no records.
+     */
+    MenuFileWriter();
+
+    /**
+     * Appends a record.
+     * @param dish A reference to the dish to store.
+     */
+    void add(const Dish& dish);
+
+    /**
+     * Appends a record.
+     * @param appetizer A reference to the appetizer to store.
+     */
+    void add(const Appetizer& appetizer);
+
+    /**
+     * Appends a record.
+     * @param main_course A reference to the main course to store, including its side dishes.
+     */
+    void add(const MainCourse& main_course);
+
+    /**
+     * Appends a record.
+     * @param dessert A reference to the dessert to store.
+     */
+    void add(const Dessert& dessert);
+
+    /**
+     * Appends every row of a catalog.
+     * @param catalog A reference to the catalog to store.
+     */
+    void add(const DishCatalog& catalog);
+
+    /**
+     * @return The number of records added so far.
+     */
+    std::size_t size() const;
+
+    /**
+     * Writes the menu file to path + ".tmp" and renames it over path, so readers that have the old file
+     * open keep reading it and a failed write leaves the old file in place.
+     * @param path The path of the file to create or replace.
+     * @param error Set to a description of the problem if the file cannot be written, or if an offset or count
+     *              of the records added outgrew its 32-bit field.
+     * @return True if the file was written, false otherwise.
+     */
+    bool write(const std::string& path, std::string& error) const;
+
+private:
+    // Appends the fields shared by every course and returns the new record
+    MenuFileRecord& addRecord(const Dish& dish, DishCatalog::Course course);
+
+    // Adds a string to the pool (once) and returns where it is
+    MenuFileString addString(std::string_view text);
+
+    // Returns value as a 32-bit field of a record, or 0 after keeping an error for write() if it does not fit
+    std::uint32_t narrow(std::size_t value, const char* what);
+
+    std::vector<MenuFileRecord> records_;
+    std::vector<MenuFileString> ingredients_;
+    std::vector<MenuFileSideDish> side_dishes_;
+    std::string strings_;
+    std::unordered_map<std::string, MenuFileString> string_index_;
+    std::string overflow_;          // the first offset or count that did not fit, write() fails if set
+};
+
+class MenuFileReader {
+public:
+    // Format constants
+    static const std::uint32_t kVersion = 1;
+    static const std::uint8_t kVegetarianFlag = 1;
+    static const std::uint8_t kGlutenFreeFlag = 2;
+    static const std::uint8_t kContainsNutsFlag = 4;
+
+    /**
+     * A lightweight handle to one record of an open menu file.
+     * Every accessor reads straight from the mapping. A Record and the views it returns stay valid until
+     * the reader is closed or destroyed.
+     */
+    class Record {
+    public:
+        Record(const MenuFileReader& reader, const MenuFileRecord& record);
+
+        DishCatalog::Course getCourse() const;
+        std::string_view getNameView() const;
+        std::size_t getIngredientCount() const;
+        std::string_view getIngredientView(std::size_t i) const;
+        int getPrepTime() const;
+        double getPrice() const;
+        Dish::CuisineType getCuisineTypeEnum() const;
+
+        // Appetizer fields, default values for other courses
+        Appetizer::ServingStyle getServingStyle() const;
+        int getSpicinessLevel() const;
+        bool isVegetarian() const;
+
+        // MainCourse fields, default values for other courses
+        MainCourse::CookingMethod getCookingMethod() const;
+        std::string_view getProteinTypeView() const;
+        std::size_t getSideDishCount() const;
+        std::string_view getSideDishNameView(std::size_t i) const;
+        MainCourse::Category getSideDishCategory(std::size_t i) const;
+        bool isGlutenFree() const;
+
+        // Dessert fields, default values for other courses
+        Dessert::FlavorProfile getFlavorProfile() const;
+        int getSweetnessLevel() const;
+        bool containsNuts() const;
+
+    private:
+        const MenuFileReader* reader_;
+        const MenuFileRecord* record_;
+    };
+
+    /**
+     * Default constructor.
+     * Creates a reader with no file open.
+     */
+    MenuFileReader();
+
+    /**
+     * Destructor.
+     * Unmaps the file if one is open.
+     */
+    ~MenuFileReader();
+
+    MenuFileReader(const MenuFileReader&) = delete;
+    MenuFileReader& operator=(const MenuFileReader&) = delete;
+
+    /**
+     * Maps a menu file and checks its header and section bounds.
+     * @param path The path of the file.
+     * @param error Set to a description of the problem if the file cannot be used.
+     * @param verify_checksum True to also check the checksum, which reads the whole file (default is false).
+     * @return True if the file is open, false otherwise.
+     */
+    bool open(const std::string& path, std::string& error, bool verify_checksum = false);
+
+    /**
+     * Unmaps the file. Every Record and view obtained from the reader becomes invalid.
+     */
+    void close();
+
+    /**
+     * @return True if the checksum in the header matches the contents of the file, false otherwise.
+     */
+    bool verifyChecksum() const;
+
+    /**
+     * @return The number of records in the file, 0 if no file is open.
+     */
+    std::size_t size() const;
+
+    /**
+     * @param index The position of the record, must be less than size().
+     * @return A handle to the record at the given position.
+     */
+    Record operator[](std::size_t index) const;
+
+    /**
+     * Computes the checksum stored in menu file headers.
+     * @param data A pointer to the first byte.
+     * @param size The number of bytes.
+     * @return A 64-bit multiply-xor checksum of the bytes, read 8 at a time.
+     */
+    static std::uint64_t checksum(const unsigned char* data, std::size_t size);
+
+private:
+    std::string_view stringAt(const MenuFileString& text) const;
+
+    const unsigned char* data_;
+    std::size_t size_;
+    const MenuFileHeader* header_;
+    const MenuFileRecord* records_;
+    const MenuFileString* ingredients_;
+    const MenuFileSideDish* side_dishes_;
+    const char* strings_;
+};
+
+#endif // MENU_FILE_HPP
@@ -0,0 +1,885 @@
+/**
+ * @file MenuImporter.cpp
+ * @brief This file contains the implementation of the MenuImporter class and its import sinks.
+ *
+ * Both formats are parsed into the same RecordFields, a set of views into the chunk (or into decoded
+ * copies for JSON strings with escapes), which buildRecord() validates and turns into a dish. Workers
+ * report line numbers relative to their chunk; the delivering thread adds the line count of the chunks
+ * before it.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "MenuImporter.hpp"
+#include "DishEnums.hpp"
+#include "NameValidation.hpp"
+#include "SmallVector.hpp"
+#include "SymbolTable.hpp"
+#include <algorithm>
+#include <charconv>  // For std::from_chars
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <variant>
+
+namespace {
+
+using ImportedDish = Menu::Item;
+
+// A block of whole lines waiting to be parsed
+struct Chunk {
+    std::size_t sequence;
+    std::string text;
+};
+
+// The dishes and rejected records of one chunk, line numbers are relative to the chunk
+struct ChunkResult {
+    std::vector<ImportedDish> dishes;
+    std::vector<MenuImporter::Error> errors;
+    std::size_t rejected = 0;
+    std::size_t lines = 0;
+    std::string buffer;  // the chunk text, returned for reuse
+};
+
+// Stops and joins the parse workers when import() returns or a sink callback throws; joinable threads
+// must never be destroyed, and the workers would otherwise wait on work_ready forever
+class WorkerShutdown {
+public:
+    WorkerShutdown(std::mutex& mutex, std::condition_variable& work_ready, std::deque<Chunk>& queue, bool& closing,
+                   std::vector<std::thread>& workers)
+        : mutex_(mutex), work_ready_(work_ready), queue_(queue), closing_(closing), workers_(workers) {
+    }
+
+    ~WorkerShutdown() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closing_ = true;
+            queue_.clear();  // Already empty unless the import is being abandoned
+        }
+        work_ready_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    WorkerShutdown(const WorkerShutdown&) = delete;
+    WorkerShutdown& operator=(const WorkerShutdown&) = delete;
+
+private:
+    std::mutex& mutex_;
+    std::condition_variable& work_ready_;
+    std::deque<Chunk>& queue_;
+    bool& closing_;
+    std::vector<std::thread>& workers_;
+};
+
+// The raw text of every field of one record
+struct RecordFields {
+    std::string_view course;
+    std::string_view name;
+    std::vector<std::string_view> ingredients;
+    std::string_view prep_time;
+    std::string_view price;
+    std::string_view cuisine_type;
+    std::string_view serving_style;
+    std::string_view spiciness_level;
+    std::string_view vegetarian;
+    std::string_view cooking_method;
+    std::string_view protein_type;
+    std::vector<std::pair<std::string_view, std::string_view>> side_dishes;
+    std::string_view gluten_free;
+    std::string_view flavor_profile;
+    std::string_view sweetness_level;
+    std::string_view contains_nuts;
+    std::deque<std::string> decoded;  // storage for strings that had to be unescaped, never moves
+
+    void clear() {
+        ingredients.clear();
+        side_dishes.clear();
+        decoded.clear();
+        course = name = prep_time = price = cuisine_type = std::string_view();
+        serving_style = spiciness_level = vegetarian = std::string_view();
+        cooking_method = protein_type = gluten_free = std::string_view();
+        flavor_profile = sweetness_level = contains_nuts = std::string_view();
+    }
+};
+
+// Enum parsing, an empty field gives the value the constructors default to
+template <typename Enum>
+bool parseEnum(std::string_view text, Enum default_value, Enum& value) {
+    if (text.empty()) {
+        value = default_value;
+        return true;
+    }
+    return DishEnums::parse(text, value);
+}
+
+// Scalar parsing, an empty field gives 0 or false
+bool parseInt(std::string_view text, int& value) {
+    value = 0;
+    if (text.empty()) {
+        return true;
+    }
+    std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), value);
+    return result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+
+bool parseDouble(std::string_view text, double& value) {
+    value = 0.0;
+    if (text.empty()) {
+        return true;
+    }
+    std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), value);
+    return result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+
+bool parseBool(std::string_view text, bool& value) {
+    value = (text == "true");
+    return value || text.empty() || text == "false";
+}
+
+std::string_view trim(std::string_view text) {
+    while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\t')) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+// Validates the fields and builds the dish, or sets message and returns false
+bool buildRecord(const RecordFields& fields, std::vector<SymbolTable::Id>& ingredient_ids, ImportedDish& dish,
+                 std::string& message) {
+    DishCatalog::Course course;
+    if (!DishEnums::parse(fields.course, course)) {
+        message = "unknown course '" + std::string(fields.course) + "'";
+        return false;
+    }
+    if (fields.name.empty()) {
+        message = "empty name";
+        return false;
+    }
+    std::size_t invalid_offset = NameValidation::firstInvalid(fields.name);
+    if (invalid_offset != NameValidation::kValid) {
+        message = "invalid name '" + std::string(fields.name) + "' at offset " + std::to_string(invalid_offset);
+        return false;
+    }
+    int prep_time;
+    double price;
+    Dish::CuisineType cuisine_type;
+    if (!parseInt(fields.prep_time, prep_time)) {
+        message = "invalid prep_time '" + std::string(fields.prep_time) + "'";
+        return false;
+    }
+    if (!parseDouble(fields.price, price)) {
+        message = "invalid price '" + std::string(fields.price) + "'";
+        return false;
+    }
+    if (!parseEnum(fields.cuisine_type, Dish::CuisineType::OTHER, cuisine_type)) {
+        message = "unknown cuisine_type '" + std::string(fields.cuisine_type) + "'";
+        return false;
+    }
+
+    // Parse the course-specific fields before interning anything: the symbol tables never shrink, so a
+    // rejected record must not add its ingredients or side dishes to them
+    Appetizer::ServingStyle serving_style = Appetizer::PLATED;
+    MainCourse::CookingMethod cooking_method = MainCourse::GRILLED;
+    Dessert::FlavorProfile flavor_profile = Dessert::SWEET;
+    int level = 0;
+    bool flag = false;
+    SmallVector<MainCourse::Category, MainCourse::kInlineSideDishes> categories;
+    switch (course) {
+        case DishCatalog::Course::APPETIZER:
+            if (!parseEnum(fields.serving_style, Appetizer::PLATED, serving_style)) {
+                message = "unknown serving_style '" + std::string(fields.serving_style) + "'";
+                return false;
+            }
+            if (!parseInt(fields.spiciness_level, level) || !parseBool(fields.vegetarian, flag)) {
+                message = "invalid spiciness_level or vegetarian";
+                return false;
+            }
+            break;
+        case DishCatalog::Course::MAIN_COURSE:
+            if (!parseEnum(fields.cooking_method, MainCourse::GRILLED, cooking_method)) {
+                message = "unknown cooking_method '" + std::string(fields.cooking_method) + "'";
+                return false;
+            }
+            if (!parseBool(fields.gluten_free, flag)) {
+                message = "invalid gluten_free '" + std::string(fields.gluten_free) + "'";
+                return false;
+            }
+            for (const std::pair<std::string_view, std::string_view>& side_dish : fields.side_dishes) {
+                MainCourse::Category category;
+                if (!parseEnum(side_dish.second, MainCourse::GRAIN, category)) {
+                    message = "unknown side dish category '" + std::string(side_dish.second) + "'";
+                    return false;
+                }
+                categories.push_back(category);
+            }
+            break;
+        case DishCatalog::Course::DESSERT:
+            if (!parseEnum(fields.flavor_profile, Dessert::SWEET, flavor_profile)) {
+                message = "unknown flavor_profile '" + std::string(fields.flavor_profile) + "'";
+                return false;
+            }
+            if (!parseInt(fields.sweetness_level, level) || !parseBool(fields.contains_nuts, flag)) {
+                message = "invalid sweetness_level or contains_nuts";
+                return false;
+            }
+            break;
+        default:
+            break;
+    }
+
+    // The record is valid, intern its strings and build the dish
+    SymbolTable& table = SymbolTable::ingredients();
+    ingredient_ids.clear();
+    for (std::string_view ingredient : fields.ingredients) {
+        ingredient_ids.push_back(table.intern(ingredient));
+    }
+
+    switch (course) {
+        case DishCatalog::Course::APPETIZER:
+            dish.emplace<Appetizer>(fields.name, std::vector<std::string>(), prep_time, price, cuisine_type,
+                                    serving_style, level, flag);
+            break;
+        case DishCatalog::Course::MAIN_COURSE: {
+            MainCourse& main_course = dish.emplace<MainCourse>(fields.name, std::vector<std::string>(), prep_time, price,
+                                                               cuisine_type, cooking_method, fields.protein_type,
+                                                               std::vector<MainCourse::SideDish>(), flag);
+            for (std::size_t k = 0; k < categories.size(); ++k) {
+                main_course.emplaceSideDish(fields.side_dishes[k].first, categories[k]);
+            }
+            break;
+        }
+        case DishCatalog::Course::DESSERT:
+            dish.emplace<Dessert>(fields.name, std::vector<std::string>(), prep_time, price, cuisine_type,
+                                  flavor_profile, level, flag);
+            break;
+        default:
+            dish.emplace<Dish>(fields.name, std::vector<std::string>(), prep_time, price, cuisine_type);
+            break;
+    }
+    std::visit([&](Dish& built) { built.setIngredientIds(ingredient_ids); }, dish);
+    return true;
+}
+
+// CSV parsing
+const std::size_t kCsvColumns = 11;
+
+// Splits a line into fields, unquoting double-quoted fields
+bool splitCsvLine(std::string_view line, std::string_view (&columns)[kCsvColumns], std::size_t& count,
+                  std::deque<std::string>& decoded, std::string& message) {
+    count = 0;
+    std::size_t pos = 0;
+    while (true) {
+        std::string_view field;
+        if (pos < line.size() && line[pos] == '"') {
+            std::size_t start = ++pos;
+            bool escaped = false;
+            while (pos < line.size() && !(line[pos] == '"' && (pos + 1 >= line.size() || line[pos + 1] != '"'))) {
+                if (line[pos] == '"') {
+                    escaped = true;
+                    ++pos;  // Skip the first quote of a doubled quote
+                }
+                ++pos;
+            }
+            if (pos >= line.size()) {
+                message = "unterminated quoted field";
+                return false;
+            }
+            field = line.substr(start, pos - start);
+            ++pos;  // Closing quote
+            if (escaped) {
+                std::string& text = decoded.emplace_back();
+                for (std::size_t i = 0; i < field.size(); ++i) {
+                    text.push_back(field[i]);
+                    i += (field[i] == '"');
+                }
+                field = text;
+            }
+            if (pos < line.size() && line[pos] != ',') {
+                message = "unexpected text after a quoted field";
+                return false;
+            }
+        } else {
+            std::size_t end = line.find(',', pos);
+            end = (end == std::string_view::npos) ? line.size() : end;
+            field = line.substr(pos, end - pos);
+            pos = end;
+        }
+        if (count == kCsvColumns) {
+            message = "more than " + std::to_string(kCsvColumns) + " columns";
+            return false;
+        }
+        columns[count++] = field;
+        if (pos >= line.size()) {
+            return true;
+        }
+        ++pos;  // Comma
+    }
+}
+
+bool parseCsvLine(std::string_view line, RecordFields& fields, std::string& message) {
+    std::string_view columns[kCsvColumns];
+    std::size_t count;
+    if (!splitCsvLine(line, columns, count, fields.decoded, message)) {
+        return false;
+    }
+    if (count < 2) {
+        message = "expected at least the course and name columns";
+        return false;
+    }
+    fields.course = columns[0];
+    fields.name = columns[1];
+    for (std::string_view list = columns[2]; !list.empty();) {
+        std::size_t end = list.find(';');
+        std::string_view ingredient = trim(list.substr(0, end));
+        if (!ingredient.empty()) {
+            fields.ingredients.push_back(ingredient);
+        }
+        list = (end == std::string_view::npos) ? std::string_view() : list.substr(end + 1);
+    }
+    fields.prep_time = columns[3];
+    fields.price = columns[4];
+    fields.cuisine_type = columns[5];
+
+    // The typed columns mean different things for each course
+    if (fields.course == "APPETIZER") {
+        fields.serving_style = columns[6];
+        fields.spiciness_level = columns[7];
+        fields.vegetarian = columns[8];
+    } else if (fields.course == "MAIN_COURSE") {
+        fields.cooking_method = columns[6];
+        fields.gluten_free = columns[8];
+        fields.protein_type = columns[9];
+        for (std::string_view list = columns[10]; !list.empty();) {
+            std::size_t end = list.find(';');
+            std::string_view entry = trim(list.substr(0, end));
+            if (!entry.empty()) {
+                std::size_t colon = entry.rfind(':');
+                if (colon == std::string_view::npos) {
+                    message = "side dish '" + std::string(entry) + "' has no category";
+                    return false;
+                }
+                fields.side_dishes.emplace_back(trim(entry.substr(0, colon)), trim(entry.substr(colon + 1)));
+            }
+            list = (end == std::string_view::npos) ? std::string_view() : list.substr(end + 1);
+        }
+    } else if (fields.course == "DESSERT") {
+        fields.flavor_profile = columns[6];
+        fields.sweetness_level = columns[7];
+        fields.contains_nuts = columns[8];
+    }
+    return true;
+}
+
+// JSON-lines parsing, just enough JSON for one flat record per line
+class JsonCursor {
+public:
+    JsonCursor(std::string_view text, std::deque<std::string>& decoded)
+        : pos_(text.data()), end_(text.data() + text.size()), decoded_(decoded) {
+    }
+
+    void skipSpace() {
+        while (pos_ != end_ && (*pos_ == ' ' || *pos_ == '\t' || *pos_ == '\r')) {
+            ++pos_;
+        }
+    }
+
+    bool consume(char c) {
+        skipSpace();
+        if (pos_ != end_ && *pos_ == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    bool atEnd() {
+        skipSpace();
+        return pos_ == end_;
+    }
+
+    bool peek(char c) {
+        skipSpace();
+        return pos_ != end_ && *pos_ == c;
+    }
+
+    // Reads a string, decoding escapes into a copy only when there are any
+    bool string(std::string_view& value) {
+        if (!consume('"')) {
+            return false;
+        }
+        const char* start = pos_;
+        while (pos_ != end_ && *pos_ != '"' && *pos_ != '\\') {
+            ++pos_;
+        }
+        if (pos_ == end_) {
+            return false;
+        }
+        if (*pos_ == '"') {
+            value = std::string_view(start, static_cast<std::size_t>(pos_ - start));
+            ++pos_;
+            return true;
+        }
+        std::string& text = decoded_.emplace_back(start, pos_);
+        while (pos_ != end_ && *pos_ != '"') {
+            if (*pos_ != '\\') {
+                text.push_back(*pos_++);
+                continue;
+            }
+            if (++pos_ == end_) {
+                return false;
+            }
+            char escape = *pos_++;
+            switch (escape) {
+                case '"': case '\\': case '/': text.push_back(escape); break;
+                case 'b': text.push_back('\b'); break;
+                case 'f': text.push_back('\f'); break;
+                case 'n': text.push_back('\n'); break;
+                case 'r': text.push_back('\r'); break;
+                case 't': text.push_back('\t'); break;
+                case 'u': {
+                    unsigned code;
+                    if (!hex4(code)) {
+                        return false;
+                    }
+                    if (code >= 0xD800 && code < 0xDC00) {
+                        unsigned low;
+                        if (end_ - pos_ < 2 || pos_[0] != '\\' || pos_[1] != 'u') {
+                            return false;
+                        }
+                        pos_ += 2;
+                        if (!hex4(low) || low < 0xDC00 || low >= 0xE000) {
+                            return false;
+                        }
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    appendUtf8(text, code);
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+        if (pos_ == end_) {
+            return false;
+        }
+        ++pos_;
+        value = text;
+        return true;
+    }
+
+    // Reads a string, a number, true, false or null as text; null reads as an empty field
+    bool scalar(std::string_view& value) {
+        skipSpace();
+        if (pos_ != end_ && *pos_ == '"') {
+            return string(value);
+        }
+        const char* start = pos_;
+        while (pos_ != end_ && *pos_ != ',' && *pos_ != '}' && *pos_ != ']' && *pos_ != ' ' && *pos_ != '\t' && *pos_ != '\r') {
+            ++pos_;
+        }
+        value = std::string_view(start, static_cast<std::size_t>(pos_ - start));
+        if (value == "null") {
+            value = std::string_view();
+            return true;
+        }
+        return !value.empty() && value[0] != '{' && value[0] != '[';
+    }
+
+    // Skips any value, including nested arrays and objects
+    bool skipValue() {
+        std::string_view ignored;
+        if (consume('[')) {
+            if (consume(']')) {
+                return true;
+            }
+            do {
+                if (!skipValue()) {
+                    return false;
+                }
+            } while (consume(','));
+            return consume(']');
+        }
+        if (consume('{')) {
+            if (consume('}')) {
+                return true;
+            }
+            do {
+                if (!string(ignored) || !consume(':') || !skipValue()) {
+                    return false;
+                }
+            } while (consume(','));
+            return consume('}');
+        }
+        return scalar(ignored);
+    }
+
+private:
+    bool hex4(unsigned& code) {
+        if (end_ - pos_ < 4) {
+            return false;
+        }
+        code = 0;
+        for (int i = 0; i < 4; ++i) {
+            char c = *pos_++;
+            code <<= 4;
+            if (c >= '0' && c <= '9') {
+                code |= static_cast<unsigned>(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                code |= static_cast<unsigned>(c - 'a' + 10);
+            } else if (c >= 'A' && c <= 'F') {
+                code |= static_cast<unsigned>(c - 'A' + 10);
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void appendUtf8(std::string& text, unsigned code) {
+        if (code < 0x80) {
+            text.push_back(static_cast<char>(code));
+        } else if (code < 0x800) {
+            text.push_back(static_cast<char>(0xC0 | (code >> 6)));
+            text.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else if (code < 0x10000) {
+            text.push_back(static_cast<char>(0xE0 | (code >> 12)));
+            text.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            text.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else {
+            text.push_back(static_cast<char>(0xF0 | (code >> 18)));
+            text.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+            text.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            text.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+    }
+
+    const char* pos_;
+    const char* end_;
+    std::deque<std::string>& decoded_;
+};
+
+bool parseJsonSideDish(JsonCursor& cursor, RecordFields& fields) {
+    std::string_view name;
+    std::string_view category;
+    if (!cursor.consume('{')) {
+        return false;
+    }
+    if (!cursor.peek('}')) {
+        do {
+            std::string_view key;
+            if (!cursor.string(key) || !cursor.consume(':')) {
+                return false;
+            }
+            bool ok = (key == "name") ? cursor.string(name) : (key == "category") ? cursor.string(category) : cursor.skipValue();
+            if (!ok) {
+                return false;
+            }
+        } while (cursor.consume(','));
+    }
+    fields.side_dishes.emplace_back(name, category);
+    return cursor.consume('}');
+}
+
+bool parseJsonLine(std::string_view line, RecordFields& fields, std::string& message) {
+    JsonCursor cursor(line, fields.decoded);
+    if (!cursor.consume('{')) {
+        message = "expected a JSON object";
+        return false;
+    }
+    if (!cursor.peek('}')) {
+        do {
+            std::string_view key;
+            if (!cursor.string(key) || !cursor.consume(':')) {
+                message = "expected a key";
+                return false;
+            }
+            bool ok = true;
+            if (key == "ingredients" || key == "side_dishes") {
+                bool ingredients = (key == "ingredients");
+                ok = cursor.consume('[');
+                if (ok && !cursor.consume(']')) {
+                    do {
+                        std::string_view ingredient;
+                        if (ingredients) {
+                            ok = cursor.string(ingredient);
+                            if (ok && !ingredient.empty()) {
+                                fields.ingredients.push_back(ingredient);
+                            }
+                        } else {
+                            ok = parseJsonSideDish(cursor, fields);
+                        }
+                    } while (ok && cursor.consume(','));
+                    ok = ok && cursor.consume(']');
+                }
+            } else {
+                std::string_view* field = nullptr;
+                if (key == "course") field = &fields.course;
+                else if (key == "name") field = &fields.name;
+                else if (key == "prep_time") field = &fields.prep_time;
+                else if (key == "price") field = &fields.price;
+                else if (key == "cuisine_type") field = &fields.cuisine_type;
+                else if (key == "serving_style") field = &fields.serving_style;
+                else if (key == "spiciness_level") field = &fields.spiciness_level;
+                else if (key == "vegetarian") field = &fields.vegetarian;
+                else if (key == "cooking_method") field = &fields.cooking_method;
+                else if (key == "protein_type") field = &fields.protein_type;
+                else if (key == "gluten_free") field = &fields.gluten_free;
+                else if (key == "flavor_profile") field = &fields.flavor_profile;
+                else if (key == "sweetness_level") field = &fields.sweetness_level;
+                else if (key == "contains_nuts") field = &fields.contains_nuts;
+                ok = (field != nullptr) ? cursor.scalar(*field) : cursor.skipValue();
+            }
+            if (!ok) {
+                message = "malformed value for '" + std::string(key) + "'";
+                return false;
+            }
+        } while (cursor.consume(','));
+    }
+    if (!cursor.consume('}') || !cursor.atEnd()) {
+        message = "malformed JSON object";
+        return false;
+    }
+    return true;
+}
+
+// Parses every line of a chunk
+void parseChunk(const std::string& text, bool first_chunk, MenuImporter::Format format, std::size_t max_errors,
+                ChunkResult& result) {
+    RecordFields fields;
+    std::vector<SymbolTable::Id> ingredient_ids;
+    std::string message;
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        std::size_t end = text.find('\n', pos);
+        end = (end == std::string::npos) ? text.size() : end;
+        std::string_view line(text.data() + pos, end - pos);
+        pos = end + 1;
+        ++result.lines;
+
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (line.empty() || (first_chunk && result.lines == 1 && format == MenuImporter::Format::CSV &&
+                             line.compare(0, 7, "course,") == 0)) {
+            continue;
+        }
+
+        fields.clear();
+        bool parsed = (format == MenuImporter::Format::CSV) ? parseCsvLine(line, fields, message)
+                                                           : parseJsonLine(line, fields, message);
+        ImportedDish dish;
+        if (parsed && buildRecord(fields, ingredient_ids, dish, message)) {
+            result.dishes.push_back(std::move(dish));
+            continue;
+        }
+        ++result.rejected;
+        if (result.errors.size() < max_errors) {
+            result.errors.push_back({result.lines, message});
+        }
+    }
+}
+
+void deliver(ImportedDish& dish, ImportSink& sink) {
+    switch (dish.index()) {
+        case 0: sink.onDish(std::move(std::get<Dish>(dish))); break;
+        case 1: sink.onAppetizer(std::move(std::get<Appetizer>(dish))); break;
+        case 2: sink.onMainCourse(std::move(std::get<MainCourse>(dish))); break;
+        default: sink.onDessert(std::move(std::get<Dessert>(dish))); break;
+    }
+}
+
+} // namespace
+
+// Import Sinks
+ImportSink::~ImportSink() {
+}
+
+CatalogImportSink::CatalogImportSink(DishCatalog& catalog) : catalog_(catalog) {
+}
+
+void CatalogImportSink::onDish(Dish&& dish) {
+    catalog_.add(dish);
+}
+
+void CatalogImportSink::onAppetizer(Appetizer&& appetizer) {
+    catalog_.add(appetizer);
+}
+
+void CatalogImportSink::onMainCourse(MainCourse&& main_course) {
+    catalog_.add(main_course);
+}
+
+void CatalogImportSink::onDessert(Dessert&& dessert) {
+    catalog_.add(dessert);
+}
+
+MenuImportSink::MenuImportSink(Menu& menu) : menu_(menu) {
+}
+
+void MenuImportSink::onDish(Dish&& dish) {
+    menu_.add(std::move(dish));
+}
+
+void MenuImportSink::onAppetizer(Appetizer&& appetizer) {
+    menu_.add(std::move(appetizer));
+}
+
+void MenuImportSink::onMainCourse(MainCourse&& main_course) {
+    menu_.add(std::move(main_course));
+}
+
+void MenuImportSink::onDessert(Dessert&& dessert) {
+    menu_.add(std::move(dessert));
+}
+
+// Constructors
+MenuImporter::MenuImporter() : MenuImporter(Options()) {
+}
+
+MenuImporter::MenuImporter(const Options& options) : options_(options) {
+    if (options_.worker_count == 0) {
+        options_.worker_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (options_.max_chunks_in_flight == 0) {
+        options_.max_chunks_in_flight = 2 * options_.worker_count;
+    }
+    options_.chunk_size = std::max<std::size_t>(options_.chunk_size, 4096);
+}
+
+// Import Functions
+bool MenuImporter::import(std::istream& in, ImportSink& sink, Result& result, std::string& error) const {
+    result = Result();
+
+    std::mutex mutex;
+    std::condition_variable work_ready;
+    std::condition_variable result_ready;
+    std::deque<Chunk> queue;
+    std::map<std::size_t, ChunkResult> finished;
+    std::vector<std::string> spare_buffers;
+    bool closing = false;
+
+    std::vector<std::thread> workers;
+    WorkerShutdown shutdown(mutex, work_ready, queue, closing, workers);
+    for (unsigned w = 0; w < options_.worker_count; ++w) {
+        workers.emplace_back([&]() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                work_ready.wait(lock, [&]() { return closing || !queue.empty(); });
+                if (queue.empty()) {
+                    return;
+                }
+                Chunk chunk = std::move(queue.front());
+                queue.pop_front();
+                lock.unlock();
+
+                ChunkResult chunk_result;
+                parseChunk(chunk.text, chunk.sequence == 0, options_.format, options_.max_errors, chunk_result);
+                chunk_result.buffer = std::move(chunk.text);
+
+                lock.lock();
+                finished.emplace(chunk.sequence, std::move(chunk_result));
+                result_ready.notify_one();
+            }
+        });
+    }
+
+    std::string carry;  // the unfinished last line of the previous read
+    std::size_t chunks_read = 0;
+    std::size_t chunks_delivered = 0;
+    bool end_of_input = false;
+    bool ok = true;
+
+    while (true) {
+        // Read the next chunk while there is room in flight
+        if (!end_of_input && chunks_read - chunks_delivered < options_.max_chunks_in_flight) {
+            std::string text;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!spare_buffers.empty()) {
+                    text = std::move(spare_buffers.back());
+                    spare_buffers.pop_back();
+                }
+            }
+            text.assign(carry);
+            std::size_t cut = std::string::npos;
+            while (cut == std::string::npos && !end_of_input) {
+                std::size_t old_size = text.size();
+                text.resize(old_size + options_.chunk_size);
+                in.read(&text[old_size], static_cast<std::streamsize>(options_.chunk_size));
+                text.resize(old_size + static_cast<std::size_t>(in.gcount()));
+                if (!in) {
+                    end_of_input = true;
+                    if (in.bad()) {
+                        error = "failed to read the menu feed";
+                        ok = false;
+                    }
+                }
+                cut = text.rfind('\n');
+            }
+            if (end_of_input) {
+                carry.clear();
+            } else {
+                carry.assign(text, cut + 1, std::string::npos);
+                text.resize(cut + 1);
+            }
+            if (!text.empty()) {
+                std::lock_guard<std::mutex> lock(mutex);
+                queue.push_back({chunks_read++, std::move(text)});
+                work_ready.notify_one();
+            }
+            continue;
+        }
+        if (end_of_input && chunks_delivered == chunks_read) {
+            break;
+        }
+
+        // Deliver the next chunk in input order
+        ChunkResult chunk_result;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            result_ready.wait(lock, [&]() { return finished.count(chunks_delivered) != 0; });
+            auto next = finished.find(chunks_delivered);
+            chunk_result = std::move(next->second);
+            finished.erase(next);
+        }
+        for (ImportedDish& dish : chunk_result.dishes) {
+            deliver(dish, sink);
+        }
+        for (Error& chunk_error : chunk_result.errors) {
+            if (result.errors.size() < options_.max_errors) {
+                chunk_error.line += result.lines;
+                result.errors.push_back(std::move(chunk_error));
+            }
+        }
+        result.imported += chunk_result.dishes.size();
+        result.rejected += chunk_result.rejected;
+        result.lines += chunk_result.lines;
+        ++chunks_delivered;
+
+        chunk_result.buffer.clear();
+        std::lock_guard<std::mutex> lock(mutex);
+        spare_buffers.push_back(std::move(chunk_result.buffer));
+    }
+    return ok;
+}
+
+bool MenuImporter::importFile(const std::string& path, ImportSink& sink, Result& result, std::string& error) const {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = "cannot open " + path;
+        return false;
+    }
+    return import(in, sink, result, error);
+}
@@ -0,0 +1,154 @@
+/**
+ * @file MenuImporter.hpp
+ * @brief This file contains the declaration of the MenuImporter class, which loads dishes from CSV and JSON-lines menu feeds.
+ *
+ * The importer reads the input in fixed-size chunks, cuts each chunk at its last line break and hands it to
+ * a pool of worker threads. Workers parse and validate their chunk and build the Dish, Appetizer, MainCourse
+ * and Dessert objects straight from views into the chunk; ingredient names are interned without building
+ * intermediate strings. The finished dishes are handed to an ImportSink on the calling thread, in input
+ * order. At most Options::max_chunks_in_flight chunks are read but not yet delivered, so memory use depends
+ * on the chunk size and not on the size of the input.
+ *
+ * Every record is one line; line breaks inside fields are not supported.
+ *
+ * CSV columns (an optional header line starting with "course," is skipped, fields may be double-quoted):
+ *     course,name,ingredients,prep_time,price,cuisine_type,style,level,flag,protein_type,side_dishes
+ * - course: DISH, APPETIZER, MAIN_COURSE or DESSERT
+ * - ingredients: names separated by ';'
+ * - style: the ServingStyle, CookingMethod or FlavorProfile of the course, empty for DISH
+ * - level: spiciness level of appetizers, sweetness level of desserts
+ * - flag: vegetarian, gluten_free or contains_nuts depending on the course (true or false)
+ * - side_dishes: main courses only, "name:CATEGORY" entries separated by ';'
+ *
+ * JSON-lines records are objects with the keys course, name, ingredients (array of strings), prep_time, price,
+ * cuisine_type, and the course fields serving_style, spiciness_level, vegetarian, cooking_method, protein_type,
+ * side_dishes (array of {"name": ..., "category": ...}), gluten_free, flavor_profile, sweetness_level and
+ * contains_nuts. Unknown keys are ignored.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef MENU_IMPORTER_HPP
+#define MENU_IMPORTER_HPP
+
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include "DishCatalog.hpp"
+#include "Menu.hpp"
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <vector>
+
+class ImportSink {
+public:
+    virtual ~ImportSink();
+
+    /**
+     * Receives one imported dish. Called on the thread that runs MenuImporter::import(), in input order.
+     * @param dish The dish, which the sink may move from.
+     */
+    virtual void onDish(Dish&& dish) = 0;
+    virtual void onAppetizer(Appetizer&& appetizer) = 0;
+    virtual void onMainCourse(MainCourse&& main_course) = 0;
+    virtual void onDessert(Dessert&& dessert) = 0;
+};
+
+class CatalogImportSink : public ImportSink {
+public:
+    /**
+     * @param catalog A reference to the catalog the dishes are added to, which must outlive the sink.
+     */
+    explicit CatalogImportSink(DishCatalog& catalog);
+
+    void onDish(Dish&& dish) override;
+    void onAppetizer(Appetizer&& appetizer) override;
+    void onMainCourse(MainCourse&& main_course) override;
+    void onDessert(Dessert&& dessert) override;
+
+private:
+    DishCatalog& catalog_;
+};
+
+class MenuImportSink : public ImportSink {
+public:
+    /**
+     * @param menu A reference to the menu the dishes are moved into, which must outlive the sink.
+     */
+    explicit MenuImportSink(Menu& menu);
+
+    void onDish(Dish&& dish) override;
+    void onAppetizer(Appetizer&& appetizer) override;
+    void onMainCourse(MainCourse&& main_course) override;
+    void onDessert(Dessert&& dessert) override;
+
+private:
+    Menu& menu_;
+};
+
+class MenuImporter {
+public:
+    // Format enum definition, the feed formats the importer reads
+    enum class Format { CSV, JSON_LINES };
+
+    struct Options {
+        Format format = Format::CSV;
+        std::size_t chunk_size = 1 << 20;           // bytes read per chunk, grown if a single line is longer
+        unsigned worker_count = 0;                  // 0 uses std::thread::hardware_concurrency()
+        std::size_t max_chunks_in_flight = 0;       // 0 uses twice the number of workers
+        std::size_t max_errors = 100;               // rejected records beyond this are counted but not described
+    };
+
+    struct Error {
+        std::size_t line;                           // 1-based line number in the input
+        std::string message;
+    };
+
+    struct Result {
+        std::size_t lines = 0;                      // lines read, including blank and header lines
+        std::size_t imported = 0;
+        std::size_t rejected = 0;
+        std::vector<Error> errors;                  // the first Options::max_errors rejected records
+    };
+
+    /**
+     * Default constructor.
+     * Creates a CSV importer with the default Options.
+     */
+    MenuImporter();
+
+    /**
+     * Parameterized constructor.
+     * @param options The format and the chunking and threading settings.
+     */
+    explicit MenuImporter(const Options& options);
+
+    /**
+     * Imports every record of a stream. Invalid records are skipped and reported in the result.
+     * @param in The stream to read, opened in binary mode for files.
+     * @param sink A reference to the sink that receives the dishes.
+     * @param result Set to the counts and the rejected records.
+     * @param error Set to a description of the problem if the stream cannot be read.
+     * @return True if the whole stream was read, false otherwise.
+     * @throw Anything the sink throws, after the parse workers have been stopped and joined.
+     */
+    bool import(std::istream& in, ImportSink& sink, Result& result, std::string& error) const;
+
+    /**
+     * Imports every record of a file.
+     * @param path The path of the file.
+     * @param sink A reference to the sink that receives the dishes.
+     * @param result Set to the counts and the rejected records.
+     * @param error Set to a description of the problem if the file cannot be read.
+     * @return True if the whole file was read, false otherwise.
+     */
+    bool importFile(const std::string& path, ImportSink& sink, Result& result, std::string& error) const;
+
+private:
+    Options options_;
+};
+
+#endif // MENU_IMPORTER_HPP
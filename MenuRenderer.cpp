@@ -0,0 +1,282 @@
+/**
+ * @file MenuRenderer.cpp
+ * @brief This file contains the implementation of the MenuRenderer class and the output sinks it writes to.
+ *
+ * Numbers are formatted with std::to_chars straight into the buffer; prices use fixed notation with two
+ * decimals, the same as std::fixed with std::setprecision(2). Enum values are printed by their names from
+ * the DishEnums tables; a value without a name prints an empty line.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "MenuRenderer.hpp"
+#include "DishEnums.hpp"
+#include <cerrno>
+#include <charconv>  // For std::to_chars
+#include <iterator>  // For std::size
+#include <unistd.h>  // For ::write
+
+namespace {
+
+// Side dish categories are printed in title case after the side dish name, in the order of MainCourse::Category
+constexpr std::string_view kCategoryLabels[] = {" (Grain)", " (Pasta)", " (Legume)", " (Bread)",
+                                                " (Salad)", " (Soup)", " (Starches)", " (Vegetable)"};
+
+std::string_view categoryLabel(MainCourse::Category category) {
+    std::size_t i = static_cast<std::size_t>(category);
+    return i < std::size(kCategoryLabels) ? kCategoryLabels[i] : std::string_view();
+}
+
+std::string_view boolLine(bool value) {
+    return value ? "True\n" : "False\n";
+}
+
+} // namespace
+
+// Output Sinks
+OutputSink::~OutputSink() {
+}
+
+void OutputSink::flush() {
+}
+
+StringSink::StringSink(std::string& out) : out_(out) {
+}
+
+void StringSink::write(const char* data, std::size_t size) {
+    out_.append(data, size);
+}
+
+OStreamSink::OStreamSink(std::ostream& out) : out_(out) {
+}
+
+void OStreamSink::write(const char* data, std::size_t size) {
+    out_.write(data, static_cast<std::streamsize>(size));
+}
+
+void OStreamSink::flush() {
+    out_.flush();
+}
+
+FdSink::FdSink(int fd) : fd_(fd), good_(true) {
+}
+
+void FdSink::write(const char* data, std::size_t size) {
+    while (size > 0 && good_) {
+        ssize_t written = ::write(fd_, data, size);
+        if (written < 0) {
+            good_ = (errno == EINTR);
+            continue;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+bool FdSink::good() const {
+    return good_;
+}
+
+// Constructor and Destructor
+MenuRenderer::MenuRenderer(OutputSink& sink, std::size_t buffer_size)
+    : sink_(sink), capacity_(buffer_size), rendered_(0) {
+    buffer_.reserve(capacity_);
+}
+
+MenuRenderer::~MenuRenderer() {
+    drain();
+}
+
+// Render Functions
+void MenuRenderer::renderDish(const Dish& dish) {
+    append("Dish Name: ");
+    append(dish.getNameView());
+    append("\nIngredients: ");
+    for (std::size_t i = 0; i < dish.getIngredientCount(); ++i) {
+        if (i != 0) {
+            append(", ");
+        }
+        append(dish.getIngredientView(i));
+    }
+    append("\n");
+    appendDishFooter(dish.getPrepTime(), dish.getPrice(), dish.getCuisineTypeEnum());
+}
+
+void MenuRenderer::renderAppetizer(const Appetizer& appetizer) {
+    appendAppetizerBlock(appetizer.getSpicinessLevel(), appetizer.getServingStyle(), appetizer.isVegetarian());
+}
+
+void MenuRenderer::renderMainCourse(const MainCourse& main_course) {
+    appendCookingMethod(main_course.getCookingMethod());
+    append("Protein Type: ");
+    append(main_course.getProteinTypeView());
+    append("\nSide Dishes: ");
+    for (std::size_t i = 0; i < main_course.getSideDishCount(); ++i) {
+        if (i != 0) {
+            append(", ");
+        }
+        appendSideDish(main_course.getSideDishNameView(i), main_course.getSideDishCategory(i));
+    }
+    append("\n");
+    appendGlutenFree(main_course.isGlutenFree());
+}
+
+void MenuRenderer::renderDessert(const Dessert& dessert) {
+    appendDessertBlock(dessert.getFlavorProfile(), dessert.getSweetnessLevel(), dessert.containsNuts());
+}
+
+void MenuRenderer::renderRow(const DishCatalog::Row& row) {
+    append("Dish Name: ");
+    append(row.getName());
+    append("\nIngredients: ");
+    for (std::size_t i = 0; i < row.getIngredientCount(); ++i) {
+        if (i != 0) {
+            append(", ");
+        }
+        append(row.getIngredient(i));
+    }
+    append("\n");
+    appendDishFooter(row.getPrepTime(), row.getPrice(), row.getCuisineTypeEnum());
+
+    switch (row.getCourse()) {
+        case DishCatalog::Course::APPETIZER:
+            appendAppetizerBlock(row.getSpicinessLevel(), row.getServingStyle(), row.isVegetarian());
+            break;
+        case DishCatalog::Course::MAIN_COURSE:
+            appendCookingMethod(row.getCookingMethod());
+            append("Protein Type: ");
+            append(row.getProteinType());
+            append("\nSide Dishes: ");
+            for (std::size_t i = 0; i < row.getSideDishCount(); ++i) {
+                if (i != 0) {
+                    append(", ");
+                }
+                appendSideDish(row.getSideDishName(i), row.getSideDishCategory(i));
+            }
+            append("\n");
+            appendGlutenFree(row.isGlutenFree());
+            break;
+        case DishCatalog::Course::DESSERT:
+            appendDessertBlock(row.getFlavorProfile(), row.getSweetnessLevel(), row.containsNuts());
+            break;
+        default:
+            break;
+    }
+}
+
+void MenuRenderer::renderCatalog(const DishCatalog& catalog) {
+    for (std::size_t i = 0; i < catalog.size(); ++i) {
+        if (i != 0) {
+            append("\n");
+        }
+        renderRow(catalog[i]);
+    }
+}
+
+void MenuRenderer::renderItem(const Menu::Item& item) {
+    renderDish(Menu::dish(item));
+    switch (Menu::course(item)) {
+        case Dish::Course::APPETIZER: renderAppetizer(*std::get_if<Appetizer>(&item)); break;
+        case Dish::Course::MAIN_COURSE: renderMainCourse(*std::get_if<MainCourse>(&item)); break;
+        case Dish::Course::DESSERT: renderDessert(*std::get_if<Dessert>(&item)); break;
+        default: break;
+    }
+}
+
+void MenuRenderer::renderMenu(const Menu& menu) {
+    for (std::size_t i = 0; i < menu.size(); ++i) {
+        if (i != 0) {
+            append("\n");
+        }
+        renderItem(menu[i]);
+    }
+}
+
+void MenuRenderer::flush() {
+    drain();
+    sink_.flush();
+}
+
+std::size_t MenuRenderer::bytesRendered() const {
+    return rendered_;
+}
+
+// Buffer Helpers
+void MenuRenderer::append(std::string_view text) {
+    if (buffer_.size() + text.size() > capacity_) {
+        drain();
+        if (text.size() > capacity_) {
+            sink_.write(text.data(), text.size());
+            rendered_ += text.size();
+            return;
+        }
+    }
+    buffer_.append(text.data(), text.size());
+    rendered_ += text.size();
+}
+
+void MenuRenderer::appendInt(int value) {
+    char digits[16];
+    std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+    append(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+}
+
+void MenuRenderer::appendPrice(double value) {
+    char digits[64];
+    std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::fixed, 2);
+    append(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+}
+
+void MenuRenderer::drain() {
+    if (!buffer_.empty()) {
+        sink_.write(buffer_.data(), buffer_.size());
+        buffer_.clear();
+    }
+}
+
+// Shared Blocks
+void MenuRenderer::appendDishFooter(int prep_time, double price, Dish::CuisineType cuisine_type) {
+    append("Preparation Time: ");
+    appendInt(prep_time);
+    append(" minutes\nPrice: $");
+    appendPrice(price);
+    append("\nCuisine Type: ");
+    std::string_view cuisine_label = DishEnums::toString(cuisine_type);
+    append(cuisine_label.empty() ? DishEnums::toString(Dish::CuisineType::OTHER) : cuisine_label);
+    append("\n");
+}
+
+void MenuRenderer::appendAppetizerBlock(int spiciness_level, Appetizer::ServingStyle serving_style, bool vegetarian) {
+    append("Spiciness Level: ");
+    appendInt(spiciness_level);
+    append("\nServing Style: ");
+    append(DishEnums::toString(serving_style));
+    append("\nVegetarian: ");
+    append(boolLine(vegetarian));
+}
+
+void MenuRenderer::appendCookingMethod(MainCourse::CookingMethod cooking_method) {
+    append("Cooking Method: ");
+    append(DishEnums::toString(cooking_method));
+    append("\n");
+}
+
+void MenuRenderer::appendSideDish(std::string_view name, MainCourse::Category category) {
+    append(name);
+    append(categoryLabel(category));
+}
+
+void MenuRenderer::appendGlutenFree(bool gluten_free) {
+    append("Gluten-Free: ");
+    append(boolLine(gluten_free));
+}
+
+void MenuRenderer::appendDessertBlock(Dessert::FlavorProfile flavor_profile, int sweetness_level, bool contains_nuts) {
+    append("Flavor Profile: ");
+    append(DishEnums::toString(flavor_profile));
+    append("\nSweetness Level: ");
+    appendInt(sweetness_level);
+    append("\nContains Nuts: ");
+    append(boolLine(contains_nuts));
+}
@@ -0,0 +1,193 @@
+/**
+ * @file MenuRenderer.hpp
+ * @brief This file contains the declaration of the MenuRenderer class and the output sinks it writes to.
+ *
+ * The MenuRenderer formats dishes into an internal buffer and hands the buffer to an OutputSink (a string,
+ * a file descriptor or a std::ostream) only when it is full or when flush() is called, so rendering a
+ * large menu costs a handful of writes instead of one flush per line. The text is exactly the text printed
+ * by Dish::display(), Appetizer::displayAppetizer(), MainCourse::displayMainCourse() and
+ * Dessert::displayDessert(), which are implemented on top of the renderer.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef MENU_RENDERER_HPP
+#define MENU_RENDERER_HPP
+
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include "DishCatalog.hpp"
+#include "Menu.hpp"
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+class OutputSink {
+public:
+    virtual ~OutputSink();
+
+    /**
+     * Writes a block of text.
+     * @param data A pointer to the first character.
+     * @param size The number of characters.
+     */
+    virtual void write(const char* data, std::size_t size) = 0;
+
+    /**
+     * Pushes any text held by the sink to its destination. Does nothing by default.
+     */
+    virtual void flush();
+};
+
+class StringSink : public OutputSink {
+public:
+    /**
+     * @param out A reference to the string the text is appended to, which must outlive the sink.
+     */
+    explicit StringSink(std::string& out);
+
+    void write(const char* data, std::size_t size) override;
+
+private:
+    std::string& out_;
+};
+
+class OStreamSink : public OutputSink {
+public:
+    /**
+     * @param out A reference to the stream the text is written to, which must outlive the sink.
+     */
+    explicit OStreamSink(std::ostream& out);
+
+    void write(const char* data, std::size_t size) override;
+    void flush() override;
+
+private:
+    std::ostream& out_;
+};
+
+class FdSink : public OutputSink {
+public:
+    /**
+     * @param fd An open file descriptor the text is written to. The sink does not close it.
+     */
+    explicit FdSink(int fd);
+
+    /**
+     * Writes the whole block, retrying after partial writes and interrupted calls.
+     */
+    void write(const char* data, std::size_t size) override;
+
+    /**
+     * @return True if every write so far succeeded, false otherwise.
+     */
+    bool good() const;
+
+private:
+    int fd_;
+    bool good_;
+};
+
+class MenuRenderer {
+public:
+    /**
+     * Parameterized constructor.
+     * @param sink A reference to the sink the text is written to, which must outlive the renderer.
+     * @param buffer_size The number of characters buffered before they are handed to the sink (default is 64 KiB).
+     */
+    explicit MenuRenderer(OutputSink& sink, std::size_t buffer_size = 64 * 1024);
+
+    /**
+     * Destructor.
+     * Hands the remaining buffered text to the sink, without calling OutputSink::flush().
+     */
+    ~MenuRenderer();
+
+    MenuRenderer(const MenuRenderer&) = delete;
+    MenuRenderer& operator=(const MenuRenderer&) = delete;
+
+    /**
+     * Renders the text of Dish::display().
+     * @param dish A reference to the dish to render.
+     */
+    void renderDish(const Dish& dish);
+
+    /**
+     * Renders the text of Appetizer::displayAppetizer().
+     * @param appetizer A reference to the appetizer to render.
+     */
+    void renderAppetizer(const Appetizer& appetizer);
+
+    /**
+     * Renders the text of MainCourse::displayMainCourse().
+     * @param main_course A reference to the main course to render.
+     */
+    void renderMainCourse(const MainCourse& main_course);
+
+    /**
+     * Renders the text of Dessert::displayDessert().
+     * @param dessert A reference to the dessert to render.
+     */
+    void renderDessert(const Dessert& dessert);
+
+    /**
+     * Renders one catalog row: the text of display() followed by the text of the course display
+     * function (if the row is an appetizer, main course or dessert).
+     * @param row A handle to the row to render.
+     */
+    void renderRow(const DishCatalog::Row& row);
+
+    /**
+     * Renders every row of a catalog in one pass, rows are separated by an empty line.
+     * @param catalog A reference to the catalog to render.
+     */
+    void renderCatalog(const DishCatalog& catalog);
+
+    /**
+     * Renders one menu item: the text of display() followed by the text of the display function of its class.
+     * @param item A reference to the item to render.
+     */
+    void renderItem(const Menu::Item& item);
+
+    /**
+     * Renders every item of a menu in one pass, items are separated by an empty line.
+     * @param menu A reference to the menu to render.
+     */
+    void renderMenu(const Menu& menu);
+
+    /**
+     * Hands the buffered text to the sink and flushes the sink.
+     */
+    void flush();
+
+    /**
+     * @return The number of characters rendered so far.
+     */
+    std::size_t bytesRendered() const;
+
+private:
+    // Buffer helpers
+    void append(std::string_view text);
+    void appendInt(int value);
+    void appendPrice(double value);
+    void drain();
+
+    // Shared blocks of the dish and row renderers
+    void appendDishFooter(int prep_time, double price, Dish::CuisineType cuisine_type);
+    void appendAppetizerBlock(int spiciness_level, Appetizer::ServingStyle serving_style, bool vegetarian);
+    void appendCookingMethod(MainCourse::CookingMethod cooking_method);
+    void appendSideDish(std::string_view name, MainCourse::Category category);
+    void appendGlutenFree(bool gluten_free);
+    void appendDessertBlock(Dessert::FlavorProfile flavor_profile, int sweetness_level, bool contains_nuts);
+
+    OutputSink& sink_;
+    std::string buffer_;
+    std::size_t capacity_;
+    std::size_t rendered_;
+};
+
+#endif // MENU_RENDERER_HPP
@@ -0,0 +1,245 @@
+/**
+ * @file MenuStatistics.cpp
+ * @brief This file contains the implementation of the MenuStatistics class.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "MenuStatistics.hpp"
+#include <cmath>
+
+// Stats Functions
+double MenuStatistics::Stats::averagePrice() const {
+    return count == 0 ? 0.0 : total_price / static_cast<double>(count);
+}
+
+double MenuStatistics::Stats::averagePrepTime() const {
+    return count == 0 ? 0.0 : static_cast<double>(total_prep_time) / static_cast<double>(count);
+}
+
+// PrepTimeHistogram Functions
+MenuStatistics::PrepTimeHistogram::PrepTimeHistogram() : counts_(kMinutes, 0), words_(), summary_(0) {
+}
+
+void MenuStatistics::PrepTimeHistogram::add(int prep_time) {
+    if (prep_time < 0 || prep_time >= kMinutes) {
+        ++outliers_[prep_time];
+        return;
+    }
+    if (counts_[prep_time]++ == 0) {
+        int word = prep_time / 64;
+        words_[word] |= std::uint64_t(1) << (prep_time % 64);
+        summary_ |= 1u << word;
+    }
+}
+
+void MenuStatistics::PrepTimeHistogram::remove(int prep_time) {
+    if (prep_time < 0 || prep_time >= kMinutes) {
+        auto found = outliers_.find(prep_time);
+        if (--found->second == 0) {
+            outliers_.erase(found);
+        }
+        return;
+    }
+    if (--counts_[prep_time] == 0) {
+        int word = prep_time / 64;
+        words_[word] &= ~(std::uint64_t(1) << (prep_time % 64));
+        if (words_[word] == 0) {
+            summary_ &= ~(1u << word);
+        }
+    }
+}
+
+int MenuStatistics::PrepTimeHistogram::min() const {
+    if (!outliers_.empty() && outliers_.begin()->first < 0) {
+        return outliers_.begin()->first;
+    }
+    if (summary_ != 0) {
+        int word = __builtin_ctz(summary_);
+        return word * 64 + __builtin_ctzll(words_[word]);
+    }
+    return outliers_.begin()->first;
+}
+
+int MenuStatistics::PrepTimeHistogram::max() const {
+    if (!outliers_.empty() && outliers_.rbegin()->first >= kMinutes) {
+        return outliers_.rbegin()->first;
+    }
+    if (summary_ != 0) {
+        int word = 31 - __builtin_clz(summary_);
+        return word * 64 + 63 - __builtin_clzll(words_[word]);
+    }
+    return outliers_.rbegin()->first;
+}
+
+// Constructor and Destructor
+MenuStatistics::MenuStatistics() : groups_(kGroupCount) {
+}
+
+MenuStatistics::~MenuStatistics() {
+    for (const auto& entry : entries_) {
+        if (entry.second.dish->getObserver() == this) {
+            entry.second.dish->setObserver(nullptr);
+        }
+    }
+}
+
+// Membership Functions
+void MenuStatistics::add(Dish& dish) {
+    Entry entry = {&dish, toMicros(dish.getPrice()), dish.getPrepTime(), dish.getAttributes()};
+    entries_.emplace(&dish, entry);
+    count(entry, 1);
+    if (dish.getObserver() == nullptr) {
+        dish.setObserver(this);
+    }
+}
+
+void MenuStatistics::remove(const Dish& dish) {
+    auto found = entries_.find(&dish);
+    if (found == entries_.end()) {
+        return;
+    }
+    if (found->second.dish->getObserver() == this) {
+        found->second.dish->setObserver(nullptr);
+    }
+    count(found->second, -1);
+    entries_.erase(found);
+}
+
+bool MenuStatistics::contains(const Dish& dish) const {
+    return entries_.count(&dish) != 0;
+}
+
+std::size_t MenuStatistics::size() const {
+    return entries_.size();
+}
+
+// Queries
+MenuStatistics::Stats MenuStatistics::total() const {
+    return stats(kTotalGroup);
+}
+
+MenuStatistics::Stats MenuStatistics::byCuisineType(Dish::CuisineType cuisine_type) const {
+    return stats(kCuisineGroups + static_cast<std::size_t>(cuisine_type));
+}
+
+MenuStatistics::Stats MenuStatistics::byCourse(Dish::Course course) const {
+    return stats(kCourseGroups + static_cast<std::size_t>(course));
+}
+
+MenuStatistics::Stats MenuStatistics::byServingStyle(Appetizer::ServingStyle serving_style) const {
+    return stats(kStyleGroups + static_cast<std::size_t>(Dish::Course::APPETIZER) * 8 + static_cast<std::size_t>(serving_style));
+}
+
+MenuStatistics::Stats MenuStatistics::byCookingMethod(MainCourse::CookingMethod cooking_method) const {
+    return stats(kStyleGroups + static_cast<std::size_t>(Dish::Course::MAIN_COURSE) * 8 + static_cast<std::size_t>(cooking_method));
+}
+
+MenuStatistics::Stats MenuStatistics::byFlavorProfile(Dessert::FlavorProfile flavor_profile) const {
+    return stats(kStyleGroups + static_cast<std::size_t>(Dish::Course::DESSERT) * 8 + static_cast<std::size_t>(flavor_profile));
+}
+
+MenuStatistics::Stats MenuStatistics::byVegetarian(bool vegetarian) const {
+    return stats(flagGroup(0, vegetarian));
+}
+
+MenuStatistics::Stats MenuStatistics::byGlutenFree(bool gluten_free) const {
+    return stats(flagGroup(1, gluten_free));
+}
+
+MenuStatistics::Stats MenuStatistics::byContainsNuts(bool contains_nuts) const {
+    return stats(flagGroup(2, contains_nuts));
+}
+
+// DishObserver Notifications
+void MenuStatistics::dishChanged(const Dish& dish, Field) {
+    auto found = entries_.find(&dish);
+    if (found == entries_.end()) {
+        return;
+    }
+    Entry& entry = found->second;
+    Entry updated = {entry.dish, toMicros(dish.getPrice()), dish.getPrepTime(), dish.getAttributes()};
+    if (updated.price_micros == entry.price_micros && updated.prep_time == entry.prep_time && updated.attributes == entry.attributes) {
+        return;  // A name or ingredient change
+    }
+    count(entry, -1);
+    entry = updated;
+    count(entry, 1);
+}
+
+void MenuStatistics::dishMoved(const Dish& from, const Dish& to) noexcept {
+    auto found = entries_.find(&from);
+    if (found == entries_.end()) {
+        return;
+    }
+    // Rekey the node in place, an erase and emplace could fail to allocate inside the noexcept move constructor
+    auto node = entries_.extract(found);
+    node.key() = &to;
+    node.mapped().dish = const_cast<Dish*>(&to);  // The statistics only hold dishes added through a non-const reference
+    entries_.insert(std::move(node));
+}
+
+void MenuStatistics::dishDestroyed(const Dish& dish) {
+    auto found = entries_.find(&dish);
+    if (found == entries_.end()) {
+        return;
+    }
+    count(found->second, -1);
+    entries_.erase(found);
+}
+
+// Aggregate Helpers
+void MenuStatistics::count(const Entry& entry, int sign) {
+    std::size_t groups[kGroupsPerDish];
+    std::size_t group_count = groupsOf(entry.attributes, groups);
+    for (std::size_t i = 0; i < group_count; ++i) {
+        Group& group = groups_[groups[i]];
+        if (sign > 0) {
+            ++group.count;
+            group.price_micros += entry.price_micros;
+            group.total_prep_time += entry.prep_time;
+            group.prep_times.add(entry.prep_time);
+        } else {
+            --group.count;
+            group.price_micros -= entry.price_micros;
+            group.total_prep_time -= entry.prep_time;
+            group.prep_times.remove(entry.prep_time);
+        }
+    }
+}
+
+MenuStatistics::Stats MenuStatistics::stats(std::size_t group) const {
+    const Group& aggregate = groups_[group];
+    Stats result = {aggregate.count, static_cast<double>(aggregate.price_micros) / 1e6, aggregate.total_prep_time, 0, 0};
+    if (aggregate.count != 0) {
+        result.min_prep_time = aggregate.prep_times.min();
+        result.max_prep_time = aggregate.prep_times.max();
+    }
+    return result;
+}
+
+std::size_t MenuStatistics::groupsOf(std::uint32_t attributes, std::size_t (&groups)[kGroupsPerDish]) {
+    std::size_t course = (attributes & Dish::kCourseMask) >> Dish::kCourseShift;
+    std::size_t count = 0;
+    groups[count++] = kTotalGroup;
+    groups[count++] = kCuisineGroups + ((attributes & Dish::kCuisineTypeMask) >> Dish::kCuisineTypeShift);
+    groups[count++] = kCourseGroups + course;
+    groups[count++] = kStyleGroups + course * 8 + ((attributes & Dish::kStyleMask) >> Dish::kStyleShift);
+    // Each flag only means something for one course
+    switch (static_cast<Dish::Course>(course)) {
+        case Dish::Course::APPETIZER: groups[count++] = flagGroup(0, (attributes & Dish::kVegetarianFlag) != 0); break;
+        case Dish::Course::MAIN_COURSE: groups[count++] = flagGroup(1, (attributes & Dish::kGlutenFreeFlag) != 0); break;
+        case Dish::Course::DESSERT: groups[count++] = flagGroup(2, (attributes & Dish::kContainsNutsFlag) != 0); break;
+        case Dish::Course::DISH: break;
+    }
+    return count;
+}
+
+std::size_t MenuStatistics::flagGroup(std::size_t flag, bool value) {
+    return kFlagGroups + flag * 2 + (value ? 1 : 0);
+}
+
+std::int64_t MenuStatistics::toMicros(double price) {
+    return std::llround(price * 1e6);
+}
@@ -0,0 +1,169 @@
+/**
+ * @file MenuStatistics.hpp
+ * @brief This file contains the declaration of the MenuStatistics class, dashboard aggregates kept up to date as dishes change.
+ *
+ * The statistics keep, for the whole set of dishes and for every cuisine type, course, serving style,
+ * cooking method, flavor profile and vegetarian / gluten-free / nut status, the number of dishes, their
+ * total price and preparation time and the smallest and largest preparation time. A dish counts in five
+ * groups, so adding, removing or changing a dish updates five groups instead of rescanning the dishes, and
+ * every query reads one group.
+ *
+ * Prices are summed in millionths so that removing a dish takes out exactly what adding it put in. The
+ * preparation times of a group are kept in a histogram of minutes with a two-level occupancy bitmap, which
+ * finds the new minimum or maximum after a removal with two bit scans; times outside 0 to 1023 minutes go
+ * to an ordered map instead.
+ *
+ * The statistics observe their dishes (see DishObserver) like OrderedIndex does: setPrice(), setPrepTime(),
+ * setCuisineType(), the setters of the derived classes, assignments, moves and destruction all show up in
+ * the next query.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef MENU_STATISTICS_HPP
+#define MENU_STATISTICS_HPP
+
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+class MenuStatistics : public DishObserver {
+public:
+    // Stats definition, the aggregates of one group of dishes
+    struct Stats {
+        std::size_t count;
+        double total_price;
+        long total_prep_time;
+        int min_prep_time;              // 0 for an empty group
+        int max_prep_time;              // 0 for an empty group
+
+        /**
+         * @return The average price, 0 for an empty group.
+         */
+        double averagePrice() const;
+
+        /**
+         * @return The average preparation time, 0 for an empty group.
+         */
+        double averagePrepTime() const;
+    };
+
+    /**
+     * Default constructor.
+     * Creates statistics over no dishes.
+     */
+    MenuStatistics();
+
+    /**
+     * Destructor.
+     * Stops observing the dishes that have the statistics as their observer.
+     */
+    ~MenuStatistics();
+
+    MenuStatistics(const MenuStatistics&) = delete;
+    MenuStatistics& operator=(const MenuStatistics&) = delete;
+
+    /**
+     * Adds a dish of any class. If the dish has no observer the statistics become its observer; otherwise
+     * they must be in the DishObserverList the dish reports to.
+     * @param dish A reference to the dish, which must not already be counted.
+     */
+    void add(Dish& dish);
+
+    /**
+     * Removes a dish.
+     * @param dish A reference to the dish.
+     */
+    void remove(const Dish& dish);
+
+    /**
+     * @param dish A reference to a dish.
+     * @return True if the dish is counted, false otherwise.
+     */
+    bool contains(const Dish& dish) const;
+
+    /**
+     * @return The number of dishes counted.
+     */
+    std::size_t size() const;
+
+    // Queries
+    Stats total() const;
+    Stats byCuisineType(Dish::CuisineType cuisine_type) const;
+    Stats byCourse(Dish::Course course) const;
+    Stats byServingStyle(Appetizer::ServingStyle serving_style) const;      // appetizers
+    Stats byCookingMethod(MainCourse::CookingMethod cooking_method) const;  // main courses
+    Stats byFlavorProfile(Dessert::FlavorProfile flavor_profile) const;     // desserts
+    Stats byVegetarian(bool vegetarian) const;                              // appetizers
+    Stats byGlutenFree(bool gluten_free) const;                             // main courses
+    Stats byContainsNuts(bool contains_nuts) const;                         // desserts
+
+    // DishObserver notifications
+    void dishChanged(const Dish& dish, Field field) override;
+    void dishMoved(const Dish& from, const Dish& to) noexcept override;
+    void dishDestroyed(const Dish& dish) override;
+
+private:
+    // Counts of preparation times, with the smallest and largest found by bit scans
+    class PrepTimeHistogram {
+    public:
+        PrepTimeHistogram();
+
+        void add(int prep_time);
+        void remove(int prep_time);
+        int min() const;                // the histogram must not be empty
+        int max() const;
+
+    private:
+        static const int kMinutes = 1024;
+        static const int kWords = kMinutes / 64;
+
+        std::vector<std::uint32_t> counts_;             // by minute
+        std::uint64_t words_[kWords];                   // bit m is set if minute m has a count
+        std::uint32_t summary_;                         // bit w is set if words_[w] is not 0
+        std::map<int, std::uint32_t> outliers_;         // times outside [0, kMinutes)
+    };
+
+    struct Group {
+        std::size_t count = 0;
+        std::int64_t price_micros = 0;
+        long total_prep_time = 0;
+        PrepTimeHistogram prep_times;
+    };
+
+    // The values the dish was counted with, so they can be taken out again after it has changed
+    struct Entry {
+        Dish* dish;
+        std::int64_t price_micros;
+        int prep_time;
+        std::uint32_t attributes;
+    };
+
+    // Group layout: the total, then cuisine types, courses, styles by course and flag values
+    static constexpr std::size_t kGroupsPerDish = 5;
+    static constexpr std::size_t kTotalGroup = 0;
+    static constexpr std::size_t kCuisineGroups = 1;
+    static constexpr std::size_t kCourseGroups = kCuisineGroups + 8;
+    static constexpr std::size_t kStyleGroups = kCourseGroups + 4;
+    static constexpr std::size_t kFlagGroups = kStyleGroups + 4 * 8;
+    static constexpr std::size_t kGroupCount = kFlagGroups + 3 * 2;
+
+    void count(const Entry& entry, int sign);
+    Stats stats(std::size_t group) const;
+
+    static std::size_t groupsOf(std::uint32_t attributes, std::size_t (&groups)[kGroupsPerDish]);
+    static std::size_t flagGroup(std::size_t flag, bool value);
+    static std::int64_t toMicros(double price);
+
+    std::vector<Group> groups_;
+    std::unordered_map<const Dish*, Entry> entries_;
+};
+
+#endif // MENU_STATISTICS_HPP
@@ -0,0 +1,219 @@
+/**
+ * @file MpmcQueue.hpp
+ * @brief This file contains the MpmcQueue class template, a bounded lock-free multi-producer multi-consumer ring buffer.
+ *
+ * The queue is Dmitry Vyukov's bounded MPMC queue: every cell carries a sequence number that tells whether
+ * it is free for the producer of a given position or filled for its consumer, so producers and consumers
+ * only contend on their own position counter and never take a lock. A batch claims several consecutive
+ * cells with a single compare-and-swap of the position, which cuts the contended operations per element
+ * by the batch size. A cell only ever becomes ready for the position it waits for, so checking a run of
+ * cells and then claiming it is safe.
+ *
+ * The operations never block: a push into a full queue or a pop from an empty one returns at once and the
+ * caller decides how to back off. Elements are copied in and out, so T should be small and trivially
+ * copyable (see OrderTicket).
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef MPMC_QUEUE_HPP
+#define MPMC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+template <typename T>
+class MpmcQueue {
+    static_assert(std::is_trivially_copyable<T>::value, "MpmcQueue copies its elements without constructors");
+
+public:
+    /**
+     * Parameterized constructor.
+     * @param capacity The number of elements the queue holds, rounded up to a power of two (at least 2).
+     */
+    explicit MpmcQueue(std::size_t capacity);
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /**
+     * Appends one element.
+     * @return True if the element was added, false if the queue is full.
+     */
+    bool tryPush(const T& value);
+
+    /**
+     * Removes the oldest element.
+     * @param value Set to the element if there is one.
+     * @return True if an element was removed, false if the queue is empty.
+     */
+    bool tryPop(T& value);
+
+    /**
+     * Appends up to `count` elements in order, as one block no other producer interleaves with.
+     * @param values A pointer to the elements.
+     * @param count The number of elements.
+     * @return The number of elements added, from the front of `values`; 0 if the queue is full.
+     */
+    std::size_t tryPushBatch(const T* values, std::size_t count);
+
+    /**
+     * Removes up to `max_count` of the oldest elements in order.
+     * @param values A pointer to room for `max_count` elements.
+     * @param max_count The largest number of elements to remove.
+     * @return The number of elements removed; 0 if the queue is empty.
+     */
+    std::size_t tryPopBatch(T* values, std::size_t max_count);
+
+    /**
+     * @return The number of elements the queue holds.
+     */
+    std::size_t capacity() const {
+        return mask_ + 1;
+    }
+
+    /**
+     * @return The number of elements in the queue, which may already have changed when it returns.
+     */
+    std::size_t sizeApprox() const;
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;  // position + 1 once filled, position + capacity once consumed
+        T value;
+    };
+
+    // The signed distance between a cell's sequence number and the one an operation expects
+    static std::intptr_t distance(std::size_t sequence, std::size_t expected) {
+        return static_cast<std::intptr_t>(sequence - expected);
+    }
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_;
+    alignas(64) std::atomic<std::size_t> enqueue_position_;
+    alignas(64) std::atomic<std::size_t> dequeue_position_;     // alignas also pads the object to a whole line
+};
+
+// Template Functions
+template <typename T>
+MpmcQueue<T>::MpmcQueue(std::size_t capacity)
+    : mask_(0), enqueue_position_(0), dequeue_position_(0) {
+    std::size_t size = 2;
+    while (size < capacity) {
+        size *= 2;
+    }
+    cells_.reset(new Cell[size]);
+    mask_ = size - 1;
+    for (std::size_t i = 0; i < size; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool MpmcQueue<T>::tryPush(const T& value) {
+    std::size_t position = enqueue_position_.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells_[position & mask_];
+        std::intptr_t diff = distance(cell.sequence.load(std::memory_order_acquire), position);
+        if (diff == 0) {
+            if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                cell.value = value;
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // The consumer of the previous lap has not taken this cell yet
+        } else {
+            position = enqueue_position_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+bool MpmcQueue<T>::tryPop(T& value) {
+    std::size_t position = dequeue_position_.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells_[position & mask_];
+        std::intptr_t diff = distance(cell.sequence.load(std::memory_order_acquire), position + 1);
+        if (diff == 0) {
+            if (dequeue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                value = cell.value;
+                cell.sequence.store(position + mask_ + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // The producer of this position has not filled the cell yet
+        } else {
+            position = dequeue_position_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+std::size_t MpmcQueue<T>::tryPushBatch(const T* values, std::size_t count) {
+    std::size_t position = enqueue_position_.load(std::memory_order_relaxed);
+    for (;;) {
+        // Count the free cells from the position on; a free cell stays free until its position is claimed
+        std::size_t ready = 0;
+        while (ready < count &&
+               distance(cells_[(position + ready) & mask_].sequence.load(std::memory_order_acquire), position + ready) == 0) {
+            ++ready;
+        }
+        if (ready == 0) {
+            if (count == 0 || distance(cells_[position & mask_].sequence.load(std::memory_order_acquire), position) < 0) {
+                return 0;
+            }
+            position = enqueue_position_.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (enqueue_position_.compare_exchange_weak(position, position + ready, std::memory_order_relaxed)) {
+            for (std::size_t i = 0; i < ready; ++i) {
+                Cell& cell = cells_[(position + i) & mask_];
+                cell.value = values[i];
+                cell.sequence.store(position + i + 1, std::memory_order_release);
+            }
+            return ready;
+        }
+    }
+}
+
+template <typename T>
+std::size_t MpmcQueue<T>::tryPopBatch(T* values, std::size_t max_count) {
+    std::size_t position = dequeue_position_.load(std::memory_order_relaxed);
+    for (;;) {
+        // Count the filled cells from the position on; a filled cell stays filled until its position is claimed
+        std::size_t ready = 0;
+        while (ready < max_count &&
+               distance(cells_[(position + ready) & mask_].sequence.load(std::memory_order_acquire), position + ready + 1) == 0) {
+            ++ready;
+        }
+        if (ready == 0) {
+            if (max_count == 0 || distance(cells_[position & mask_].sequence.load(std::memory_order_acquire), position + 1) < 0) {
+                return 0;
+            }
+            position = dequeue_position_.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (dequeue_position_.compare_exchange_weak(position, position + ready, std::memory_order_relaxed)) {
+            for (std::size_t i = 0; i < ready; ++i) {
+                Cell& cell = cells_[(position + i) & mask_];
+                values[i] = cell.value;
+                cell.sequence.store(position + i + mask_ + 1, std::memory_order_release);
+            }
+            return ready;
+        }
+    }
+}
+
+template <typename T>
+std::size_t MpmcQueue<T>::sizeApprox() const {
+    std::size_t enqueued = enqueue_position_.load(std::memory_order_relaxed);
+    std::size_t dequeued = dequeue_position_.load(std::memory_order_relaxed);
+    return enqueued > dequeued ? enqueued - dequeued : 0;
+}
+
+#endif // MPMC_QUEUE_HPP
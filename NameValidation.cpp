@@ -0,0 +1,119 @@
+/**
+ * @file NameValidation.cpp
+ * @brief This file contains the implementation of the NameValidation functions.
+ *
+ * The SSE2 path checks every full 16-byte block of a name, then the last 16 bytes once more (overlapping
+ * the previous block) so the tail needs no scalar loop and no read past the end of the name. Names shorter
+ * than 16 bytes use the lookup table.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "NameValidation.hpp"
+#include <cstdint>
+
+#if defined(__SSE2__)
+#define NAME_VALIDATION_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace NameValidation {
+
+namespace {
+
+// Character class table, true for the characters a name may contain
+struct NameCharTable {
+    bool valid[256];
+
+    constexpr NameCharTable() : valid{} {
+        for (int c = 'A'; c <= 'Z'; ++c) {
+            valid[c] = true;
+            valid[c + ('a' - 'A')] = true;
+        }
+        for (int c = '\t'; c <= '\r'; ++c) {
+            valid[c] = true;
+        }
+        valid[static_cast<unsigned char>(' ')] = true;
+    }
+};
+
+constexpr NameCharTable kNameChars;
+
+std::size_t firstInvalidScalar(const char* data, std::size_t size, std::size_t from) {
+    for (std::size_t i = from; i < size; ++i) {
+        if (!kNameChars.valid[static_cast<unsigned char>(data[i])]) {
+            return i;
+        }
+    }
+    return kValid;
+}
+
+#ifdef NAME_VALIDATION_SSE2
+// Returns a mask with bit i set if byte i of the block is not a letter or whitespace
+unsigned invalidMask(const char* block) {
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+    // Letters: folding to lower case keeps 'a'..'z' in one signed range, bytes >= 0x80 are negative
+    const __m128i folded = _mm_or_si128(bytes, _mm_set1_epi8(0x20));
+    const __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)),
+                                         _mm_cmplt_epi8(folded, _mm_set1_epi8('z' + 1)));
+    // Whitespace: ' ' or '\t'..'\r'
+    const __m128i control = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('\t' - 1)),
+                                          _mm_cmplt_epi8(bytes, _mm_set1_epi8('\r' + 1)));
+    const __m128i space = _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(' ')), control);
+    return ~static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(letter, space))) & 0xFFFFu;
+}
+
+std::size_t firstInvalidSse2(const char* data, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        if (unsigned mask = invalidMask(data + i)) {
+            return i + static_cast<std::size_t>(__builtin_ctz(mask));
+        }
+    }
+    if (i < size) {
+        // The last block overlaps bytes already checked, those are valid so only the new ones can be set
+        std::size_t start = size - 16;
+        if (unsigned mask = invalidMask(data + start)) {
+            return start + static_cast<std::size_t>(__builtin_ctz(mask));
+        }
+    }
+    return kValid;
+}
+#endif // NAME_VALIDATION_SSE2
+
+inline std::size_t firstInvalid(const char* data, std::size_t size) {
+#ifdef NAME_VALIDATION_SSE2
+    if (size >= 16) {
+        return firstInvalidSse2(data, size);
+    }
+#endif
+    return firstInvalidScalar(data, size, 0);
+}
+
+template <typename String>
+std::size_t validateBatch(ArrayView<String> names, std::size_t* offsets) {
+    std::size_t invalid = 0;
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        offsets[i] = firstInvalid(names[i].data(), names[i].size());
+        invalid += offsets[i] != kValid;
+    }
+    return invalid;
+}
+
+} // namespace
+
+// Validation Functions
+std::size_t firstInvalid(std::string_view name) {
+    return firstInvalid(name.data(), name.size());
+}
+
+std::size_t validate(ArrayView<std::string_view> names, std::size_t* offsets) {
+    return validateBatch(names, offsets);
+}
+
+std::size_t validate(ArrayView<std::string> names, std::size_t* offsets) {
+    return validateBatch(names, offsets);
+}
+
+} // namespace NameValidation
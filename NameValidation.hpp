@@ -0,0 +1,52 @@
+/**
+ * @file NameValidation.hpp
+ * @brief This file contains the declaration of the NameValidation functions, which check dish names one at a time or in batches.
+ *
+ * A valid name contains only ASCII letters and whitespace (space, tab, line feed, vertical tab, form feed
+ * and carriage return), the characters std::isalpha and std::isspace accept in the "C" locale the program
+ * runs in. Instead of calling into the locale once per character, the functions classify characters with a
+ * 256-entry table and, where SSE2 is available, 16 characters per instruction. Every function reports the
+ * offset of the first invalid character so an importer can say where a name went wrong.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef NAME_VALIDATION_HPP
+#define NAME_VALIDATION_HPP
+
+#include "ArrayView.hpp"
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace NameValidation {
+
+// The offset reported for a valid name
+constexpr std::size_t kValid = std::string_view::npos;
+
+/**
+ * @param name The name to check.
+ * @return The offset of the first character that is neither a letter nor whitespace, kValid if there is none.
+ */
+std::size_t firstInvalid(std::string_view name);
+
+/**
+ * Checks a batch of names.
+ * @param names A view of the names to check.
+ * @param offsets Set to the result of firstInvalid() for every name, must hold names.size() entries.
+ * @return The number of invalid names.
+ */
+std::size_t validate(ArrayView<std::string_view> names, std::size_t* offsets);
+
+/**
+ * Checks a batch of names.
+ * @param names A view of the names to check.
+ * @param offsets Set to the result of firstInvalid() for every name, must hold names.size() entries.
+ * @return The number of invalid names.
+ */
+std::size_t validate(ArrayView<std::string> names, std::size_t* offsets);
+
+} // namespace NameValidation
+
+#endif // NAME_VALIDATION_HPP
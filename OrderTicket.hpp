@@ -0,0 +1,41 @@
+/**
+ * @file OrderTicket.hpp
+ * @brief This file contains the OrderTicket struct, the compact record front-of-house threads hand to kitchen stations.
+ *
+ * A ticket names a dish by id instead of carrying a copy of it: the id is a menu index or the DishId of an
+ * index the stations share, so a ticket is 16 bytes and four fit in a cache line. TicketQueue is the
+ * bounded lock-free queue tickets travel through.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef ORDER_TICKET_HPP
+#define ORDER_TICKET_HPP
+
+#include "MpmcQueue.hpp"
+#include <cstdint>
+
+struct OrderTicket {
+    // Modifier flags definition, requests the station has to honour
+    enum Modifier : std::uint16_t {
+        NO_NUTS = 1 << 0,
+        VEGETARIAN = 1 << 1,
+        GLUTEN_FREE = 1 << 2,
+        EXTRA_SPICY = 1 << 3,
+        SAUCE_ON_SIDE = 1 << 4,
+        RUSH = 1 << 5
+    };
+
+    std::uint32_t dish_id;          // menu index or DishId
+    std::uint16_t table;
+    std::uint16_t modifiers;        // Modifier bits
+    std::uint64_t timestamp;        // nanoseconds on a clock the producers and consumers agree on
+};
+
+static_assert(sizeof(OrderTicket) == 16, "OrderTicket should stay a quarter of a cache line");
+
+// The queue between order intake and the kitchen stations
+using TicketQueue = MpmcQueue<OrderTicket>;
+
+#endif // ORDER_TICKET_HPP
@@ -0,0 +1,207 @@
+/**
+ * @file OrderedIndex.cpp
+ * @brief This file contains the implementation of the OrderedIndex class.
+ *
+ * Each entry keeps the price, preparation time and attribute word the dish was indexed with, so a change
+ * is handled in dishChanged() alone: the old keys come from the entry and the new ones from the dish.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "OrderedIndex.hpp"
+#include <limits>
+
+// Query Constructor
+OrderedIndex::Query::Query()
+    : min_price(-std::numeric_limits<double>::infinity()), max_price(std::numeric_limits<double>::infinity()),
+      min_prep_time(std::numeric_limits<int>::min()), max_prep_time(std::numeric_limits<int>::max()),
+      limit(std::numeric_limits<std::size_t>::max()) {
+}
+
+// Constructor and Destructor
+OrderedIndex::OrderedIndex() {
+}
+
+OrderedIndex::~OrderedIndex() {
+    for (const Entry& entry : entries_) {
+        if (entry.dish != nullptr && entry.dish->getObserver() == this) {
+            entry.dish->setObserver(nullptr);
+        }
+    }
+}
+
+// Membership Functions
+OrderedIndex::DishId OrderedIndex::add(Dish& dish) {
+    Entry entry = {&dish, dish.getPrice(), dish.getPrepTime(), dish.getAttributes()};
+    DishId id;
+    if (!free_ids_.empty()) {
+        id = free_ids_.back();
+        free_ids_.pop_back();
+        entries_[id] = entry;
+    } else {
+        id = static_cast<DishId>(entries_.size());
+        entries_.push_back(entry);
+    }
+    ids_.emplace(&dish, id);
+    index(id);
+    if (dish.getObserver() == nullptr) {
+        dish.setObserver(this);
+    }
+    return id;
+}
+
+void OrderedIndex::remove(const Dish& dish) {
+    auto found = ids_.find(&dish);
+    if (found == ids_.end()) {
+        return;
+    }
+    DishId id = found->second;
+    if (entries_[id].dish->getObserver() == this) {
+        entries_[id].dish->setObserver(nullptr);
+    }
+    ids_.erase(found);
+    release(id);
+}
+
+bool OrderedIndex::find(const Dish& dish, DishId& id) const {
+    auto found = ids_.find(&dish);
+    if (found == ids_.end()) {
+        return false;
+    }
+    id = found->second;
+    return true;
+}
+
+const Dish* OrderedIndex::dish(DishId id) const {
+    return id < entries_.size() ? entries_[id].dish : nullptr;
+}
+
+std::size_t OrderedIndex::size() const {
+    return ids_.size();
+}
+
+// Queries
+std::vector<OrderedIndex::DishId> OrderedIndex::byPrice(const Query& query) const {
+    return scan(by_price_, query.min_price, query.max_price, query);
+}
+
+std::vector<OrderedIndex::DishId> OrderedIndex::byPrepTime(const Query& query) const {
+    return scan(by_prep_time_, query.min_prep_time, query.max_prep_time, query);
+}
+
+// DishObserver Notifications
+void OrderedIndex::dishChanged(const Dish& dish, Field) {
+    auto found = ids_.find(&dish);
+    if (found == ids_.end()) {
+        return;
+    }
+    // Every setter can change the attribute word, only a new key, course or cuisine type moves the dish
+    Entry& entry = entries_[found->second];
+    std::uint32_t attributes = dish.getAttributes();
+    if (dish.getPrice() != entry.price || dish.getPrepTime() != entry.prep_time || partition(attributes) != partition(entry.attributes)) {
+        unindex(found->second);
+        entry.price = dish.getPrice();
+        entry.prep_time = dish.getPrepTime();
+        entry.attributes = attributes;
+        index(found->second);
+    } else {
+        entry.attributes = attributes;
+    }
+}
+
+void OrderedIndex::dishMoved(const Dish& from, const Dish& to) noexcept {
+    auto found = ids_.find(&from);
+    if (found == ids_.end()) {
+        return;
+    }
+    // Rekey the node in place, an erase and emplace could fail to allocate inside the noexcept move constructor
+    auto node = ids_.extract(found);
+    node.key() = &to;
+    DishId id = node.mapped();
+    ids_.insert(std::move(node));
+    entries_[id].dish = const_cast<Dish*>(&to);  // The index only holds dishes added through a non-const reference
+}
+
+void OrderedIndex::dishDestroyed(const Dish& dish) {
+    auto found = ids_.find(&dish);
+    if (found == ids_.end()) {
+        return;
+    }
+    DishId id = found->second;
+    ids_.erase(found);
+    release(id);
+}
+
+// Index Helpers
+void OrderedIndex::index(DishId id) {
+    const Entry& entry = entries_[id];
+    std::size_t p = partition(entry.attributes);
+    by_price_[p].insert(entry.price, id);
+    by_prep_time_[p].insert(entry.prep_time, id);
+}
+
+void OrderedIndex::unindex(DishId id) {
+    const Entry& entry = entries_[id];
+    std::size_t p = partition(entry.attributes);
+    by_price_[p].erase(entry.price, id);
+    by_prep_time_[p].erase(entry.prep_time, id);
+}
+
+void OrderedIndex::release(DishId id) {
+    unindex(id);
+    entries_[id].dish = nullptr;
+    free_ids_.push_back(id);
+}
+
+bool OrderedIndex::passes(DishId id, const Query& query) const {
+    const Entry& entry = entries_[id];
+    return query.filter.matches(entry.attributes)
+        && entry.price >= query.min_price && entry.price <= query.max_price
+        && entry.prep_time >= query.min_prep_time && entry.prep_time <= query.max_prep_time;
+}
+
+template <typename Key>
+std::vector<OrderedIndex::DishId> OrderedIndex::scan(const BlockedSortedSet<Key> (&partitions)[kPartitions], Key min_key, Key max_key, const Query& query) const {
+    using Cursor = typename BlockedSortedSet<Key>::Cursor;
+
+    // Start a cursor in every partition the filter allows; a filter on the course and cuisine type allows one
+    std::uint32_t partition_mask = query.filter.mask() & kPartitionMask;
+    std::uint32_t partition_value = query.filter.value() & kPartitionMask;
+    std::vector<Cursor> cursors;
+    for (std::size_t p = 0; p < kPartitions; ++p) {
+        if ((static_cast<std::uint32_t>(p) & partition_mask) != partition_value) {
+            continue;
+        }
+        Cursor cursor = partitions[p].lowerBound(min_key);
+        if (cursor.valid()) {
+            cursors.push_back(cursor);
+        }
+    }
+
+    // Merge the partitions in key order, stopping at the first key past the range or at the limit
+    std::vector<DishId> result;
+    while (!cursors.empty() && result.size() < query.limit) {
+        std::size_t next = 0;
+        for (std::size_t i = 1; i < cursors.size(); ++i) {
+            if (*cursors[i] < *cursors[next]) {
+                next = i;
+            }
+        }
+        if (max_key < (*cursors[next]).key) {
+            break;
+        }
+        if (passes((*cursors[next]).id, query)) {
+            result.push_back((*cursors[next]).id);
+        }
+        cursors[next].next();
+        if (!cursors[next].valid()) {
+            cursors.erase(cursors.begin() + static_cast<std::ptrdiff_t>(next));
+        }
+    }
+    return result;
+}
+
+std::size_t OrderedIndex::partition(std::uint32_t attributes) {
+    return attributes & kPartitionMask;
+}
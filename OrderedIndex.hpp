@@ -0,0 +1,149 @@
+/**
+ * @file OrderedIndex.hpp
+ * @brief This file contains the declaration of the OrderedIndex class, ordered secondary indexes on the price and preparation time of dishes.
+ *
+ * Every dish added to the index gets a small dish id, which is kept in two BlockedSortedSets per course
+ * and cuisine type: one ordered by price and one ordered by preparation time. A query such as "the 20
+ * cheapest Italian main courses under 25 minutes" starts at the lowest price of the Italian main course
+ * partition and stops as soon as it has 20 dishes, instead of scanning and sorting every dish. A query
+ * that does not fix the course or the cuisine type merges the partitions it allows in key order. The other conditions of a query are tested against a
+ * copy of the attribute word (see AttributeFilter) and of the other key, so a query never reads the
+ * dishes themselves.
+ *
+ * The index observes its dishes (see DishObserver) and moves a dish between positions and partitions when
+ * setPrice(), setPrepTime() or setCuisineType() is called, when a dish is assigned or moved and when it is
+ * destroyed.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef ORDERED_INDEX_HPP
+#define ORDERED_INDEX_HPP
+
+#include "Dish.hpp"
+#include "AttributeFilter.hpp"
+#include "BlockedSortedSet.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class OrderedIndex : public DishObserver {
+public:
+    // DishId type definition, the position of a dish in the index
+    using DishId = std::uint32_t;
+
+    // Query definition, a dish is returned if it passes every condition; the bounds are inclusive
+    struct Query {
+        AttributeFilter filter;
+        double min_price;
+        double max_price;
+        int min_prep_time;
+        int max_prep_time;
+        std::size_t limit;  // the scan stops after this many dishes
+
+        /**
+         * Default constructor.
+         * Creates a query every dish passes, without a limit.
+         */
+        Query();
+    };
+
+    /**
+     * Default constructor.
+     * Creates an empty index.
+     */
+    OrderedIndex();
+
+    /**
+     * Destructor.
+     * Stops observing the dishes that have the index as their observer.
+     */
+    ~OrderedIndex();
+
+    OrderedIndex(const OrderedIndex&) = delete;
+    OrderedIndex& operator=(const OrderedIndex&) = delete;
+
+    /**
+     * Adds a dish of any class to the index. If the dish has no observer the index becomes its observer;
+     * otherwise the index must be in the DishObserverList the dish reports to.
+     * @param dish A reference to the dish, which must not already be in the index.
+     * @return The id of the dish in the index.
+     */
+    DishId add(Dish& dish);
+
+    /**
+     * Removes a dish from the index; its id may be given to a dish added later.
+     * @param dish A reference to the dish.
+     */
+    void remove(const Dish& dish);
+
+    /**
+     * @param dish A reference to a dish.
+     * @param id Set to the id of the dish if it is in the index.
+     * @return True if the dish is in the index, false otherwise.
+     */
+    bool find(const Dish& dish, DishId& id) const;
+
+    /**
+     * @param id The id of a dish in the index.
+     * @return A pointer to the dish, nullptr if the id is not in use.
+     */
+    const Dish* dish(DishId id) const;
+
+    /**
+     * @return The number of dishes in the index.
+     */
+    std::size_t size() const;
+
+    // Queries
+    /**
+     * @param query The conditions and the limit.
+     * @return The ids of the dishes that pass the query, by increasing price (equal prices by id).
+     */
+    std::vector<DishId> byPrice(const Query& query) const;
+
+    /**
+     * @param query The conditions and the limit.
+     * @return The ids of the dishes that pass the query, by increasing preparation time (equal times by id).
+     */
+    std::vector<DishId> byPrepTime(const Query& query) const;
+
+    // DishObserver notifications
+    void dishChanged(const Dish& dish, Field field) override;
+    void dishMoved(const Dish& from, const Dish& to) noexcept override;
+    void dishDestroyed(const Dish& dish) override;
+
+private:
+    // One partition per course and cuisine type, the low bits of the attribute word
+    static constexpr std::uint32_t kPartitionMask = Dish::kCourseMask | Dish::kCuisineTypeMask;
+    static constexpr std::size_t kPartitions = kPartitionMask + 1;
+    static_assert((kPartitionMask & (kPartitionMask + 1)) == 0, "the partition bits must start at bit 0");
+
+    // The keys the dish is indexed under, so it can be found again after the dish has changed
+    struct Entry {
+        Dish* dish;
+        double price;
+        int prep_time;
+        std::uint32_t attributes;
+    };
+
+    void index(DishId id);
+    void unindex(DishId id);
+    void release(DishId id);
+    bool passes(DishId id, const Query& query) const;
+
+    template <typename Key>
+    std::vector<DishId> scan(const BlockedSortedSet<Key> (&partitions)[kPartitions], Key min_key, Key max_key, const Query& query) const;
+
+    static std::size_t partition(std::uint32_t attributes);
+
+    std::vector<Entry> entries_;                    // by dish id, dish is nullptr for free ids
+    std::vector<DishId> free_ids_;
+    std::unordered_map<const Dish*, DishId> ids_;
+    BlockedSortedSet<double> by_price_[kPartitions];
+    BlockedSortedSet<int> by_prep_time_[kPartitions];
+};
+
+#endif // ORDERED_INDEX_HPP
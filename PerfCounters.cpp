@@ -0,0 +1,173 @@
+/**
+ * @file PerfCounters.cpp
+ * @brief This file contains the implementation of the PerfCounters class.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "PerfCounters.hpp"
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const std::string_view kEventNames[PerfCounters::kEventCount] = {"cycles", "instructions", "L1D read misses", "LLC misses", "branch misses"};
+
+#ifdef __linux__
+// Sets the perf type and config of an event
+void describe(PerfCounters::Event event, perf_event_attr& attr) {
+    switch (event) {
+        case PerfCounters::Event::CYCLES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case PerfCounters::Event::INSTRUCTIONS:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case PerfCounters::Event::L1D_READ_MISSES:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case PerfCounters::Event::LLC_MISSES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case PerfCounters::Event::BRANCH_MISSES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+    }
+}
+#endif
+
+} // namespace
+
+// Counts Functions
+bool PerfCounters::Counts::has(Event event) const {
+    return valid[static_cast<std::size_t>(event)];
+}
+
+std::uint64_t PerfCounters::Counts::operator[](Event event) const {
+    return has(event) ? values[static_cast<std::size_t>(event)] : 0;
+}
+
+double PerfCounters::Counts::ipc() const {
+    if (!has(Event::CYCLES) || !has(Event::INSTRUCTIONS) || (*this)[Event::CYCLES] == 0) {
+        return 0.0;
+    }
+    return static_cast<double>((*this)[Event::INSTRUCTIONS]) / static_cast<double>((*this)[Event::CYCLES]);
+}
+
+void PerfCounters::Counts::add(const Counts& other) {
+    for (std::size_t i = 0; i < kEventCount; ++i) {
+        values[i] += other.values[i];
+        valid[i] = valid[i] && other.valid[i];
+    }
+}
+
+// Constructor and Destructor
+PerfCounters::PerfCounters() {
+    for (int& fd : fds_) {
+        fd = -1;
+    }
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+#endif
+}
+
+// Counter Functions
+bool PerfCounters::open(std::string& error) {
+#ifdef __linux__
+    error.clear();
+    int first_errno = 0;
+    bool same_errno = true;
+    for (std::size_t i = 0; i < kEventCount; ++i) {
+        if (fds_[i] >= 0) {
+            continue;
+        }
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        describe(static_cast<Event>(i), attr);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        fds_[i] = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        if (fds_[i] < 0) {
+            same_errno = same_errno && (first_errno == 0 || first_errno == errno);
+            first_errno = errno;
+            error += (error.empty() ? "" : "; ") + std::string(kEventNames[i]) + ": " + std::strerror(errno);
+        }
+    }
+    if (!isOpen() && same_errno) {
+        error = std::string("perf_event_open: ") + std::strerror(first_errno);  // Typically no PMU or no permission
+    }
+    return isOpen();
+#else
+    error = "perf_event_open is only available on Linux";
+    return false;
+#endif
+}
+
+bool PerfCounters::isOpen() const {
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PerfCounters::start() {
+#ifdef __linux__
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+PerfCounters::Counts PerfCounters::stop() {
+    Counts counts;
+#ifdef __linux__
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    for (std::size_t i = 0; i < kEventCount; ++i) {
+        std::uint64_t data[3];  // value, time enabled, time running
+        if (fds_[i] < 0 || ::read(fds_[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) {
+            continue;
+        }
+        // Scale a multiplexed event up to the whole time it was enabled
+        double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+        counts.values[i] = static_cast<std::uint64_t>(static_cast<double>(data[0]) * scale + 0.5);
+        counts.valid[i] = true;
+    }
+#endif
+    return counts;
+}
+
+std::string_view PerfCounters::eventName(Event event) {
+    return kEventNames[static_cast<std::size_t>(event)];
+}
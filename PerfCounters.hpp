@@ -0,0 +1,109 @@
+/**
+ * @file PerfCounters.hpp
+ * @brief This file contains the declaration of the PerfCounters class, hardware performance counters read around a measured region.
+ *
+ * The counters are opened with the Linux perf_event_open system call for the calling thread, in user space
+ * only, so they work with the default perf_event_paranoid setting. Each event is opened on its own rather
+ * than as a group: an event the processor or the kernel does not offer (or that a container or virtual
+ * machine hides) is left out, and the others still count. When the kernel multiplexes more events than the
+ * processor has counters, the counts are scaled by the share of the time each event was counting.
+ *
+ * If no event can be opened, open() says why and the counters stay empty, so a caller can always call
+ * start() and stop() and simply print what is valid.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+class PerfCounters {
+public:
+    // Event enum definition, the counters that are read
+    enum class Event { CYCLES, INSTRUCTIONS, L1D_READ_MISSES, LLC_MISSES, BRANCH_MISSES };
+    static constexpr std::size_t kEventCount = 5;
+
+    // Counts definition, the events counted between start() and stop()
+    struct Counts {
+        std::uint64_t values[kEventCount] = {};
+        bool valid[kEventCount] = {};       // false for events that could not be opened or never ran
+
+        /**
+         * @param event An event.
+         * @return True if the event was counted.
+         */
+        bool has(Event event) const;
+
+        /**
+         * @param event An event.
+         * @return The count of the event, 0 if it was not counted.
+         */
+        std::uint64_t operator[](Event event) const;
+
+        /**
+         * @return Instructions per cycle, 0 if either was not counted.
+         */
+        double ipc() const;
+
+        /**
+         * Adds the counts of another region; an event stays valid only if it is valid in both.
+         * @param other The counts to add.
+         */
+        void add(const Counts& other);
+    };
+
+    /**
+     * Default constructor.
+     * Creates closed counters; see open().
+     */
+    PerfCounters();
+
+    /**
+     * Destructor.
+     * Closes the counters.
+     */
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * Opens every event it can for the calling thread.
+     * @param error Set to the events that could not be opened and why, if any.
+     * @return True if at least one event was opened, false otherwise.
+     */
+    bool open(std::string& error);
+
+    /**
+     * @return True if at least one event is open.
+     */
+    bool isOpen() const;
+
+    /**
+     * Resets and starts every open event.
+     */
+    void start();
+
+    /**
+     * Stops every open event.
+     * @return The counts since start().
+     */
+    Counts stop();
+
+    /**
+     * @param event An event.
+     * @return The name of the event, e.g. "cycles".
+     */
+    static std::string_view eventName(Event event);
+
+private:
+    int fds_[kEventCount];
+};
+
+#endif // PERF_COUNTERS_HPP
@@ -0,0 +1,311 @@
+/**
+ * @file RoaringBitmap.cpp
+ * @brief This file contains the implementation of the RoaringBitmap class.
+ *
+ * Set operations return containers in their canonical form: an array while they hold at most
+ * kMaxArraySize values and a bitset above that. add() turns an array into a bitset as soon as it passes
+ * kMaxArraySize, but remove() keeps a bitset until it falls below kMinBitsetSize, so a posting list that
+ * churns around the limit is not converted back and forth. Empty containers are dropped.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "RoaringBitmap.hpp"
+#include <algorithm>
+#include <iterator>
+
+// Container Helpers
+bool RoaringBitmap::Container::contains(std::uint16_t low) const {
+    if (isBitset()) {
+        return (bitset[low >> 6] >> (low & 63)) & 1;
+    }
+    return std::binary_search(array.begin(), array.end(), low);
+}
+
+void RoaringBitmap::Container::toBitset() {
+    bitset.assign(kBitsetWords, 0);
+    for (std::uint16_t low : array) {
+        bitset[low >> 6] |= std::uint64_t(1) << (low & 63);
+    }
+    std::vector<std::uint16_t>().swap(array);
+}
+
+void RoaringBitmap::Container::toArray() {
+    array.clear();
+    array.reserve(cardinality);
+    for (std::size_t w = 0; w < kBitsetWords; ++w) {
+        for (std::uint64_t word = bitset[w]; word != 0; word &= word - 1) {
+            array.push_back(static_cast<std::uint16_t>(w * 64 + __builtin_ctzll(word)));
+        }
+    }
+    std::vector<std::uint64_t>().swap(bitset);
+}
+
+// Constructor
+RoaringBitmap::RoaringBitmap() {
+}
+
+// Element Functions
+void RoaringBitmap::add(std::uint32_t value) {
+    std::uint16_t key = static_cast<std::uint16_t>(value >> 16);
+    std::uint16_t low = static_cast<std::uint16_t>(value);
+    std::size_t i = findContainer(key);
+    if (i == containers_.size() || containers_[i].key != key) {
+        Container container;
+        container.key = key;
+        container.cardinality = 1;
+        container.array.push_back(low);
+        containers_.insert(containers_.begin() + static_cast<std::ptrdiff_t>(i), std::move(container));
+        return;
+    }
+
+    Container& container = containers_[i];
+    if (container.isBitset()) {
+        std::uint64_t& word = container.bitset[low >> 6];
+        std::uint64_t bit = std::uint64_t(1) << (low & 63);
+        container.cardinality += (word & bit) == 0;
+        word |= bit;
+        return;
+    }
+    auto position = std::lower_bound(container.array.begin(), container.array.end(), low);
+    if (position != container.array.end() && *position == low) {
+        return;
+    }
+    container.array.insert(position, low);
+    ++container.cardinality;
+    if (container.cardinality > kMaxArraySize) {
+        container.toBitset();
+    }
+}
+
+void RoaringBitmap::remove(std::uint32_t value) {
+    std::uint16_t key = static_cast<std::uint16_t>(value >> 16);
+    std::uint16_t low = static_cast<std::uint16_t>(value);
+    std::size_t i = findContainer(key);
+    if (i == containers_.size() || containers_[i].key != key) {
+        return;
+    }
+
+    Container& container = containers_[i];
+    if (container.isBitset()) {
+        std::uint64_t& word = container.bitset[low >> 6];
+        std::uint64_t bit = std::uint64_t(1) << (low & 63);
+        if ((word & bit) == 0) {
+            return;
+        }
+        word &= ~bit;
+        if (--container.cardinality < kMinBitsetSize) {
+            container.toArray();
+        }
+        return;
+    }
+    auto position = std::lower_bound(container.array.begin(), container.array.end(), low);
+    if (position == container.array.end() || *position != low) {
+        return;
+    }
+    container.array.erase(position);
+    if (--container.cardinality == 0) {
+        containers_.erase(containers_.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+}
+
+bool RoaringBitmap::contains(std::uint32_t value) const {
+    std::uint16_t key = static_cast<std::uint16_t>(value >> 16);
+    std::size_t i = findContainer(key);
+    return i != containers_.size() && containers_[i].key == key && containers_[i].contains(static_cast<std::uint16_t>(value));
+}
+
+std::size_t RoaringBitmap::cardinality() const {
+    std::size_t total = 0;
+    for (const Container& container : containers_) {
+        total += container.cardinality;
+    }
+    return total;
+}
+
+bool RoaringBitmap::empty() const {
+    return containers_.empty();
+}
+
+void RoaringBitmap::clear() {
+    containers_.clear();
+}
+
+// Set Operations
+RoaringBitmap RoaringBitmap::intersect(const RoaringBitmap& other) const {
+    RoaringBitmap result;
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < containers_.size() && j < other.containers_.size()) {
+        if (containers_[i].key < other.containers_[j].key) {
+            ++i;
+        } else if (containers_[i].key > other.containers_[j].key) {
+            ++j;
+        } else {
+            Container container = intersectContainers(containers_[i++], other.containers_[j++]);
+            if (container.cardinality != 0) {
+                result.containers_.push_back(std::move(container));
+            }
+        }
+    }
+    return result;
+}
+
+RoaringBitmap RoaringBitmap::unite(const RoaringBitmap& other) const {
+    RoaringBitmap result;
+    result.containers_.reserve(containers_.size() + other.containers_.size());
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < containers_.size() || j < other.containers_.size()) {
+        if (j == other.containers_.size() || (i < containers_.size() && containers_[i].key < other.containers_[j].key)) {
+            result.containers_.push_back(containers_[i++]);
+        } else if (i == containers_.size() || containers_[i].key > other.containers_[j].key) {
+            result.containers_.push_back(other.containers_[j++]);
+        } else {
+            result.containers_.push_back(uniteContainers(containers_[i++], other.containers_[j++]));
+        }
+    }
+    return result;
+}
+
+RoaringBitmap RoaringBitmap::subtract(const RoaringBitmap& other) const {
+    RoaringBitmap result;
+    std::size_t j = 0;
+    for (const Container& container : containers_) {
+        while (j < other.containers_.size() && other.containers_[j].key < container.key) {
+            ++j;
+        }
+        if (j == other.containers_.size() || other.containers_[j].key != container.key) {
+            result.containers_.push_back(container);
+            continue;
+        }
+        Container difference = subtractContainers(container, other.containers_[j]);
+        if (difference.cardinality != 0) {
+            result.containers_.push_back(std::move(difference));
+        }
+    }
+    return result;
+}
+
+std::vector<std::uint32_t> RoaringBitmap::toVector() const {
+    std::vector<std::uint32_t> values;
+    values.reserve(cardinality());
+    forEach([&values](std::uint32_t value) { values.push_back(value); });
+    return values;
+}
+
+std::size_t RoaringBitmap::memoryUsage() const {
+    std::size_t bytes = containers_.capacity() * sizeof(Container);
+    for (const Container& container : containers_) {
+        bytes += container.array.capacity() * sizeof(std::uint16_t) + container.bitset.capacity() * sizeof(std::uint64_t);
+    }
+    return bytes;
+}
+
+// Container Kernels
+std::size_t RoaringBitmap::findContainer(std::uint16_t key) const {
+    auto position = std::lower_bound(containers_.begin(), containers_.end(), key,
+                                     [](const Container& container, std::uint16_t k) { return container.key < k; });
+    return static_cast<std::size_t>(position - containers_.begin());
+}
+
+RoaringBitmap::Container RoaringBitmap::intersectContainers(const Container& a, const Container& b) {
+    Container result;
+    result.key = a.key;
+    if (a.isBitset() && b.isBitset()) {
+        result.bitset.resize(kBitsetWords);
+        std::size_t count = 0;
+        for (std::size_t w = 0; w < kBitsetWords; ++w) {
+            result.bitset[w] = a.bitset[w] & b.bitset[w];
+            count += static_cast<std::size_t>(__builtin_popcountll(result.bitset[w]));
+        }
+        result.cardinality = static_cast<std::uint32_t>(count);
+        if (count <= kMaxArraySize) {
+            result.toArray();
+        }
+        return result;
+    }
+    if (a.isBitset() || b.isBitset()) {
+        const Container& array = a.isBitset() ? b : a;
+        const Container& bitset = a.isBitset() ? a : b;
+        for (std::uint16_t low : array.array) {
+            if (bitset.contains(low)) {
+                result.array.push_back(low);
+            }
+        }
+    } else {
+        std::set_intersection(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), std::back_inserter(result.array));
+    }
+    result.cardinality = static_cast<std::uint32_t>(result.array.size());
+    return result;
+}
+
+RoaringBitmap::Container RoaringBitmap::uniteContainers(const Container& a, const Container& b) {
+    Container result;
+    result.key = a.key;
+    if (!a.isBitset() && !b.isBitset() && a.cardinality + b.cardinality <= kMaxArraySize) {
+        result.array.reserve(a.cardinality + b.cardinality);
+        std::set_union(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), std::back_inserter(result.array));
+        result.cardinality = static_cast<std::uint32_t>(result.array.size());
+        return result;
+    }
+    result.bitset.assign(kBitsetWords, 0);
+    for (const Container* source : {&a, &b}) {
+        if (source->isBitset()) {
+            for (std::size_t w = 0; w < kBitsetWords; ++w) {
+                result.bitset[w] |= source->bitset[w];
+            }
+        } else {
+            for (std::uint16_t low : source->array) {
+                result.bitset[low >> 6] |= std::uint64_t(1) << (low & 63);
+            }
+        }
+    }
+    std::size_t count = 0;
+    for (std::uint64_t word : result.bitset) {
+        count += static_cast<std::size_t>(__builtin_popcountll(word));
+    }
+    result.cardinality = static_cast<std::uint32_t>(count);
+    if (count <= kMaxArraySize) {
+        result.toArray();
+    }
+    return result;
+}
+
+RoaringBitmap::Container RoaringBitmap::subtractContainers(const Container& a, const Container& b) {
+    Container result;
+    result.key = a.key;
+    if (a.isBitset()) {
+        result.bitset = a.bitset;
+        if (b.isBitset()) {
+            for (std::size_t w = 0; w < kBitsetWords; ++w) {
+                result.bitset[w] &= ~b.bitset[w];
+            }
+        } else {
+            for (std::uint16_t low : b.array) {
+                result.bitset[low >> 6] &= ~(std::uint64_t(1) << (low & 63));
+            }
+        }
+        std::size_t count = 0;
+        for (std::uint64_t word : result.bitset) {
+            count += static_cast<std::size_t>(__builtin_popcountll(word));
+        }
+        result.cardinality = static_cast<std::uint32_t>(count);
+        if (count <= kMaxArraySize) {
+            result.toArray();
+        }
+        return result;
+    }
+    if (b.isBitset()) {
+        for (std::uint16_t low : a.array) {
+            if (!b.contains(low)) {
+                result.array.push_back(low);
+            }
+        }
+    } else {
+        std::set_difference(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), std::back_inserter(result.array));
+    }
+    result.cardinality = static_cast<std::uint32_t>(result.array.size());
+    return result;
+}
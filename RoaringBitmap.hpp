@@ -0,0 +1,145 @@
+/**
+ * @file RoaringBitmap.hpp
+ * @brief This file contains the declaration of the RoaringBitmap class, a compressed set of 32-bit integers.
+ *
+ * The values are split by their high 16 bits into containers of up to 65536 values. A container with at
+ * most 4096 values is a sorted array of the low 16 bits (2 bytes per value); a fuller one is a 65536-bit
+ * bitset (8 KiB). A bitset emptied by remove() stays a bitset until it falls below 2048 values. Set operations work container by container and pick the kernel for each pair of
+ * container kinds, so sparse posting lists stay small and dense ones are combined 64 values per word.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef ROARING_BITMAP_HPP
+#define ROARING_BITMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class RoaringBitmap {
+public:
+    /**
+     * Default constructor.
+     * Creates an empty bitmap.
+     */
+    RoaringBitmap();
+
+    /**
+     * Adds a value.
+     * @param value The value to add.
+     */
+    void add(std::uint32_t value);
+
+    /**
+     * Removes a value.
+     * @param value The value to remove.
+     */
+    void remove(std::uint32_t value);
+
+    /**
+     * @param value The value to look up.
+     * @return True if the value is in the bitmap, false otherwise.
+     */
+    bool contains(std::uint32_t value) const;
+
+    /**
+     * @return The number of values in the bitmap.
+     */
+    std::size_t cardinality() const;
+
+    /**
+     * @return True if the bitmap has no values, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * Removes every value.
+     */
+    void clear();
+
+    /**
+     * @param other A reference to another bitmap.
+     * @return The values in both bitmaps.
+     */
+    RoaringBitmap intersect(const RoaringBitmap& other) const;
+
+    /**
+     * @param other A reference to another bitmap.
+     * @return The values in either bitmap.
+     */
+    RoaringBitmap unite(const RoaringBitmap& other) const;
+
+    /**
+     * @param other A reference to another bitmap.
+     * @return The values in this bitmap and not in `other`.
+     */
+    RoaringBitmap subtract(const RoaringBitmap& other) const;
+
+    /**
+     * @return Every value in increasing order.
+     */
+    std::vector<std::uint32_t> toVector() const;
+
+    /**
+     * Calls a function with every value in increasing order.
+     * @param function The function to call with each value.
+     */
+    template <typename Function>
+    void forEach(Function function) const;
+
+    /**
+     * @return The number of bytes used by the containers.
+     */
+    std::size_t memoryUsage() const;
+
+private:
+    // Containers with more values than this are bitsets
+    static const std::size_t kMaxArraySize = 4096;
+    // remove() only turns a bitset back into an array below this, so churn around kMaxArraySize does not
+    // convert the container on every add and remove
+    static const std::size_t kMinBitsetSize = kMaxArraySize / 2;
+    static const std::size_t kBitsetWords = 1024;
+
+    struct Container {
+        std::uint16_t key;                  // the high 16 bits of every value in the container
+        std::uint32_t cardinality;
+        std::vector<std::uint16_t> array;   // sorted low 16 bits, used while the container is small
+        std::vector<std::uint64_t> bitset;  // kBitsetWords words, used once the container is full
+
+        bool isBitset() const { return !bitset.empty(); }
+        bool contains(std::uint16_t low) const;
+        void toBitset();
+        void toArray();
+    };
+
+    // Returns the position of the container with the key, or where it would be inserted
+    std::size_t findContainer(std::uint16_t key) const;
+
+    static Container intersectContainers(const Container& a, const Container& b);
+    static Container uniteContainers(const Container& a, const Container& b);
+    static Container subtractContainers(const Container& a, const Container& b);
+
+    std::vector<Container> containers_;  // sorted by key, never empty
+};
+
+template <typename Function>
+void RoaringBitmap::forEach(Function function) const {
+    for (const Container& container : containers_) {
+        std::uint32_t high = static_cast<std::uint32_t>(container.key) << 16;
+        if (container.isBitset()) {
+            for (std::size_t w = 0; w < kBitsetWords; ++w) {
+                for (std::uint64_t word = container.bitset[w]; word != 0; word &= word - 1) {
+                    function(high | static_cast<std::uint32_t>(w * 64 + __builtin_ctzll(word)));
+                }
+            }
+        } else {
+            for (std::uint16_t low : container.array) {
+                function(high | low);
+            }
+        }
+    }
+}
+
+#endif // ROARING_BITMAP_HPP
@@ -0,0 +1,354 @@
+/**
+ * @file SmallVector.hpp
+ * @brief This file contains the SmallVector class template, a vector that keeps up to N elements inside the object.
+ *
+ * Most dishes have a handful of ingredients and at most a few side dishes, so a SmallVector holding those
+ * lists needs no heap block at all: the elements live in the object next to the other members of the dish.
+ * Only a list longer than N spills to a block from the std::pmr memory resource of the vector, which then
+ * grows like a std::vector. Like std::pmr::vector, the memory resource is fixed at construction and is not
+ * propagated by assignment; moving a spilled vector hands its block over when both use the same resource.
+ *
+ * Moving a SmallVector whose elements are inline moves the elements one by one, so unlike a std::vector
+ * it invalidates pointers and views into the source.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename T, std::size_t N>
+class SmallVector {
+public:
+    static_assert(N > 0, "SmallVector needs an inline capacity of at least one element");
+    static_assert(std::is_nothrow_move_constructible_v<T>, "SmallVector moves its elements when it grows");
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using allocator_type = std::pmr::polymorphic_allocator<T>;
+
+    // The number of elements held without a heap block
+    static constexpr std::size_t kInlineCapacity = N;
+
+    /**
+     * Default constructor.
+     * Creates an empty vector that spills to the default memory resource.
+     */
+    SmallVector() : SmallVector(allocator_type()) {
+    }
+
+    /**
+     * Creates an empty vector.
+     * @param alloc The allocator a list longer than N takes its block from.
+     */
+    explicit SmallVector(const allocator_type& alloc)
+        : alloc_(alloc), size_(0), capacity_(static_cast<std::uint32_t>(N)) {
+    }
+
+    /**
+     * Creates a vector holding a copy of a range.
+     * @param first The first element of the range, a forward iterator.
+     * @param last One past the last element of the range.
+     * @param alloc The allocator a list longer than N takes its block from.
+     */
+    template <typename ForwardIt,
+              typename = std::enable_if_t<std::is_base_of_v<std::forward_iterator_tag,
+                                                            typename std::iterator_traits<ForwardIt>::iterator_category>>>
+    SmallVector(ForwardIt first, ForwardIt last, const allocator_type& alloc = {}) : SmallVector(alloc) {
+        assign(first, last);
+    }
+
+    /**
+     * Creates a vector holding a copy of a list.
+     * @param values The elements.
+     * @param alloc The allocator a list longer than N takes its block from.
+     */
+    SmallVector(std::initializer_list<T> values, const allocator_type& alloc = {}) : SmallVector(alloc) {
+        assign(values.begin(), values.end());
+    }
+
+    /**
+     * Copy constructor.
+     * @param other The vector to copy.
+     * @param alloc The allocator of the copy (default is the default memory resource, as for std::pmr::vector).
+     */
+    SmallVector(const SmallVector& other, const allocator_type& alloc = {}) : SmallVector(alloc) {
+        assign(other.begin(), other.end());
+    }
+
+    /**
+     * Move constructor, the new vector keeps the allocator of `other`.
+     * @param other The vector to move from, left empty.
+     */
+    SmallVector(SmallVector&& other) noexcept : SmallVector(other.alloc_) {
+        takeFrom(other);
+    }
+
+    /**
+     * Move constructor with an allocator.
+     * @param other The vector to move from, left empty.
+     * @param alloc The allocator of the new vector, the elements are moved one by one if it differs from the one of `other`.
+     */
+    SmallVector(SmallVector&& other, const allocator_type& alloc) : SmallVector(alloc) {
+        if (alloc_ == other.alloc_) {
+            takeFrom(other);
+        } else {
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
+        }
+    }
+
+    ~SmallVector() {
+        clear();
+        releaseBlock();
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) {
+        if (this == &other) {
+            return *this;
+        }
+        if (alloc_ == other.alloc_) {
+            clear();
+            releaseBlock();
+            takeFrom(other);
+        } else {
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> values) {
+        assign(values.begin(), values.end());
+        return *this;
+    }
+
+    /**
+     * @return The allocator a list longer than N takes its block from.
+     */
+    allocator_type get_allocator() const {
+        return alloc_;
+    }
+
+    // Element Access
+    T* data() {
+        return isInline() ? inlineData() : heap_;
+    }
+
+    const T* data() const {
+        return isInline() ? inlineData() : heap_;
+    }
+
+    /**
+     * @param i The position of the element, must be less than size().
+     * @return A reference to the element at position i.
+     */
+    T& operator[](std::size_t i) {
+        return data()[i];
+    }
+
+    const T& operator[](std::size_t i) const {
+        return data()[i];
+    }
+
+    T& front() {
+        return data()[0];
+    }
+
+    const T& front() const {
+        return data()[0];
+    }
+
+    T& back() {
+        return data()[size_ - 1];
+    }
+
+    const T& back() const {
+        return data()[size_ - 1];
+    }
+
+    iterator begin() {
+        return data();
+    }
+
+    const_iterator begin() const {
+        return data();
+    }
+
+    iterator end() {
+        return data() + size_;
+    }
+
+    const_iterator end() const {
+        return data() + size_;
+    }
+
+    // Capacity
+    std::size_t size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    std::size_t capacity() const {
+        return capacity_;
+    }
+
+    /**
+     * @return True while the elements live inside the object, false once the vector has spilled to a heap block.
+     */
+    bool isInline() const {
+        return capacity_ == N;
+    }
+
+    /**
+     * Makes room for elements, spilling to a heap block if more than N are asked for.
+     * @param capacity The number of elements the vector should hold without reallocating.
+     */
+    void reserve(std::size_t capacity) {
+        if (capacity > capacity_) {
+            T* block = alloc_.allocate(capacity);
+            relocate(block, capacity);
+        }
+    }
+
+    // Modifiers
+    /**
+     * Replaces the elements with a copy of a range, reusing the current storage when it is large enough.
+     * @param first The first element of the range, a forward iterator that does not point into this vector.
+     * @param last One past the last element of the range.
+     */
+    template <typename ForwardIt>
+    void assign(ForwardIt first, ForwardIt last) {
+        clear();
+        reserve(static_cast<std::size_t>(std::distance(first, last)));
+        T* elements = data();
+        for (; first != last; ++first) {
+            ::new (static_cast<void*>(elements + size_)) T(*first);
+            ++size_;
+        }
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    /**
+     * Constructs an element at the end. The arguments may refer to elements of the vector.
+     * @param args The arguments of a constructor of T.
+     * @return A reference to the new element.
+     */
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ < capacity_) {
+            ::new (static_cast<void*>(data() + size_)) T(std::forward<Args>(args)...);
+        } else {
+            // Construct the new element before moving the old ones, the arguments may point into them
+            std::size_t capacity = std::size_t(capacity_) * 2;
+            T* block = alloc_.allocate(capacity);
+            try {
+                ::new (static_cast<void*>(block + size_)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                alloc_.deallocate(block, capacity);
+                throw;
+            }
+            relocate(block, capacity);
+        }
+        ++size_;
+        return back();
+    }
+
+    void pop_back() {
+        --size_;
+        data()[size_].~T();
+    }
+
+    /**
+     * Destroys every element. A spilled vector keeps its heap block.
+     */
+    void clear() {
+        std::destroy(data(), data() + size_);
+        size_ = 0;
+    }
+
+private:
+    T* inlineData() {
+        return std::launder(reinterpret_cast<T*>(inline_));
+    }
+
+    const T* inlineData() const {
+        return std::launder(reinterpret_cast<const T*>(inline_));
+    }
+
+    // Moves the elements into a new heap block and frees the old one
+    void relocate(T* block, std::size_t capacity) {
+        T* elements = data();
+        std::uninitialized_move(elements, elements + size_, block);
+        std::destroy(elements, elements + size_);
+        releaseBlock();
+        heap_ = block;
+        capacity_ = static_cast<std::uint32_t>(capacity);
+    }
+
+    // Frees the heap block, if any, and goes back to the inline storage; the vector must be empty
+    void releaseBlock() {
+        if (!isInline()) {
+            alloc_.deallocate(heap_, capacity_);
+            capacity_ = static_cast<std::uint32_t>(N);
+        }
+    }
+
+    // Takes the elements of `other`, which uses the same allocator; this vector must be empty and inline
+    void takeFrom(SmallVector& other) noexcept {
+        if (other.isInline()) {
+            std::uninitialized_move(other.inlineData(), other.inlineData() + other.size_, inlineData());
+            size_ = other.size_;
+            other.clear();
+        } else {
+            heap_ = other.heap_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.size_ = 0;
+            other.capacity_ = static_cast<std::uint32_t>(N);
+        }
+    }
+
+    allocator_type alloc_;
+    std::uint32_t size_;
+    std::uint32_t capacity_;                        // N while the elements are inline, a heap block is always larger
+    union {
+        T* heap_;                                   // a block from alloc_
+        alignas(T) unsigned char inline_[N * sizeof(T)];
+    };
+};
+
+#endif // SMALL_VECTOR_HPP
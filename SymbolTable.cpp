@@ -0,0 +1,103 @@
+/**
+ * @file SymbolTable.cpp
+ * @brief This file contains the implementation of the SymbolTable class, which interns repeated strings such as ingredients.
+ *
+ * name() takes no lock: it reads the segment pointer with an acquire load, and segments are never moved.
+ * Looking up a string (find() and the first pass of intern()) takes a shared lock so many threads can
+ * resolve strings at once; only interning a new string takes the exclusive lock.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "SymbolTable.hpp"
+#include <mutex>
+
+namespace {
+
+// Returns the segment that holds an id and the position of the id inside it
+void locate(std::size_t id, std::size_t first_segment_size, std::size_t& segment, std::size_t& offset) {
+    std::size_t block = id / first_segment_size + 1;
+    segment = static_cast<std::size_t>(63 - __builtin_clzll(block));
+    offset = id - first_segment_size * ((std::size_t(1) << segment) - 1);
+}
+
+} // namespace
+
+SymbolTable& SymbolTable::ingredients() {
+    static SymbolTable table;
+    return table;
+}
+
+SymbolTable& SymbolTable::sideDishes() {
+    static SymbolTable table;
+    return table;
+}
+
+// Constructor
+SymbolTable::SymbolTable() : size_(0) {
+    for (std::atomic<std::string*>& segment : segments_) {
+        segment.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+// Destructor
+SymbolTable::~SymbolTable() {
+    for (std::atomic<std::string*>& segment : segments_) {
+        delete[] segment.load(std::memory_order_relaxed);
+    }
+}
+
+// Interning Functions
+SymbolTable::Id SymbolTable::intern(std::string_view text) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto found = ids_.find(text);
+        if (found != ids_.end()) {
+            return found->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto found = ids_.find(text);  // Another thread may have interned it in between
+    if (found != ids_.end()) {
+        return found->second;
+    }
+    std::size_t next = size_.load(std::memory_order_relaxed);
+    std::size_t segment = 0;
+    std::size_t offset = 0;
+    locate(next, kFirstSegmentSize, segment, offset);
+    std::string* strings = segments_[segment].load(std::memory_order_relaxed);
+    if (strings == nullptr) {
+        strings = new std::string[kFirstSegmentSize << segment];
+        segments_[segment].store(strings, std::memory_order_release);
+    }
+    strings[offset] = std::string(text);
+    size_.store(next + 1, std::memory_order_release);
+
+    Id id = static_cast<Id>(next);
+    ids_.emplace(std::string_view(strings[offset]), id);
+    return id;
+}
+
+bool SymbolTable::find(std::string_view text, Id& id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto found = ids_.find(text);
+    if (found == ids_.end()) {
+        return false;
+    }
+    id = found->second;
+    return true;
+}
+
+// Accessor Functions
+const std::string& SymbolTable::name(Id id) const {
+    std::size_t segment = 0;
+    std::size_t offset = 0;
+    locate(id, kFirstSegmentSize, segment, offset);
+    return segments_[segment].load(std::memory_order_acquire)[offset];
+}
+
+std::size_t SymbolTable::size() const {
+    return size_.load(std::memory_order_acquire);
+}
@@ -0,0 +1,94 @@
+/**
+ * @file SymbolTable.hpp
+ * @brief This file contains the declaration of the SymbolTable class, which interns repeated strings such as ingredients.
+ *
+ * Every distinct string is stored once and mapped to a compact 32-bit id, so a dish only needs to keep the ids
+ * of its ingredients. Comparing two ingredients becomes an integer comparison and the string can still be
+ * looked up from its id. Ids are never reused and strings are never removed, so an id stays valid for the
+ * lifetime of the program. All functions are safe to call from several threads, and resolving an id to its
+ * string takes no lock.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef SYMBOL_TABLE_HPP
+#define SYMBOL_TABLE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+class SymbolTable {
+public:
+    // Id type definition, the compact handle of an interned string
+    using Id = std::uint32_t;
+
+    /**
+     * @return The process-wide table of ingredient names.
+     */
+    static SymbolTable& ingredients();
+
+    /**
+     * @return The process-wide table of side dish names.
+     */
+    static SymbolTable& sideDishes();
+
+    /**
+     * Default constructor.
+     * Creates an empty table.
+     */
+    SymbolTable();
+
+    /**
+     * Destructor.
+     * Frees every interned string.
+     */
+    ~SymbolTable();
+
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    /**
+     * Interns a string.
+     * @param text The string to intern.
+     * @return The id of the string, a new id is assigned the first time a string is seen.
+     */
+    Id intern(std::string_view text);
+
+    /**
+     * Looks up a string without interning it.
+     * @param text The string to look up.
+     * @param id Set to the id of the string if it was found.
+     * @return True if the string has been interned before, false otherwise.
+     */
+    bool find(std::string_view text, Id& id) const;
+
+    /**
+     * @param id An id returned by intern().
+     * @return The string the id was assigned to. The reference stays valid for the lifetime of the table.
+     */
+    const std::string& name(Id id) const;
+
+    /**
+     * @return The number of distinct strings in the table.
+     */
+    std::size_t size() const;
+
+private:
+    // The strings are kept in segments that double in size and are never moved, so name() can read
+    // them without a lock. Segment k holds kFirstSegmentSize << k strings.
+    static const std::size_t kFirstSegmentSize = 64;
+    static const std::size_t kSegmentCount = 27;
+
+    mutable std::shared_mutex mutex_;
+    std::atomic<std::string*> segments_[kSegmentCount];
+    std::atomic<std::size_t> size_;
+    std::unordered_map<std::string_view, Id> ids_;       // keys point into the segments
+};
+
+#endif // SYMBOL_TABLE_HPP
@@ -0,0 +1,217 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief This file contains the implementation of the ThreadPool class.
+ *
+ * The deque follows Lê, Pop, Cohen and Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory
+ * Models" (PPoPP 2013), with a fixed capacity: a worker whose deque is full runs the new task at once.
+ * A worker goes to sleep only after reading the spawn epoch, so a task spawned while it is deciding to sleep
+ * either shows up in its last search or changes the epoch it waits on.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "ThreadPool.hpp"
+
+namespace {
+
+// Yields before a worker without tasks goes to sleep
+const unsigned kIdleSpins = 64;
+
+// The pool and worker index of the current thread, nullptr outside every pool
+thread_local const ThreadPool* t_pool = nullptr;
+thread_local unsigned t_worker = 0;
+thread_local std::uint32_t t_random = 0x9e3779b9u;
+
+// xorshift32, picks the first victim to steal from
+std::uint32_t nextRandom() {
+    t_random ^= t_random << 13;
+    t_random ^= t_random >> 17;
+    t_random ^= t_random << 5;
+    return t_random;
+}
+
+} // namespace
+
+// WorkDeque Functions
+ThreadPool::WorkDeque::WorkDeque()
+    : top_(0), bottom_(0), buffer_(new std::atomic<Task*>[kCapacity]) {
+}
+
+bool ThreadPool::WorkDeque::push(Task* task) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    if (bottom - top >= kCapacity) {
+        return false;
+    }
+    // Release on the slot as well as the fence, so a thief that reads the slot also sees the task it points to
+    buffer_[bottom & (kCapacity - 1)].store(task, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return true;
+}
+
+ThreadPool::Task* ThreadPool::WorkDeque::pop() {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    Task* task = buffer_[bottom & (kCapacity - 1)].load(std::memory_order_relaxed);
+    if (top == bottom) {
+        // The last task, a thief may be taking it at the same time
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            task = nullptr;
+        }
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return task;
+}
+
+ThreadPool::Task* ThreadPool::WorkDeque::steal() {
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) {
+        return nullptr;
+    }
+    Task* task = buffer_[top & (kCapacity - 1)].load(std::memory_order_acquire);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return nullptr;  // Lost the race to the owner or another thief
+    }
+    return task;
+}
+
+// TaskGroup Functions
+void ThreadPool::TaskGroup::wait() {
+    while (pending_.load(std::memory_order_acquire) != 0) {
+        if (Task* task = pool_.findTask()) {
+            execute(task);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// Constructor and Destructor
+ThreadPool::ThreadPool(unsigned worker_count)
+    : injection_size_(0), epoch_(0), sleeping_(0), stopping_(false) {
+    if (worker_count == 0) {
+        worker_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (unsigned i = 0; i < worker_count; ++i) {
+        deques_.push_back(std::make_unique<WorkDeque>());
+    }
+    for (unsigned i = 0; i < worker_count; ++i) {
+        workers_.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+unsigned ThreadPool::workerCount() const {
+    return static_cast<unsigned>(workers_.size());
+}
+
+// Scheduling Functions
+void ThreadPool::spawn(Task* task) {
+    if (t_pool == this) {
+        if (!deques_[t_worker]->push(task)) {
+            execute(task);  // The deque is full, which only happens with very deep spawning
+            return;
+        }
+    } else {
+        std::lock_guard<std::mutex> lock(injection_mutex_);
+        injection_.push_back(task);
+        injection_size_.fetch_add(1, std::memory_order_release);
+    }
+    notifyWorkers();
+}
+
+ThreadPool::Task* ThreadPool::findTask() {
+    bool worker = (t_pool == this);
+    if (worker) {
+        if (Task* task = deques_[t_worker]->pop()) {
+            return task;
+        }
+    }
+    if (injection_size_.load(std::memory_order_acquire) != 0) {
+        std::lock_guard<std::mutex> lock(injection_mutex_);
+        if (!injection_.empty()) {
+            Task* task = injection_.front();
+            injection_.pop_front();
+            injection_size_.fetch_sub(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+    std::size_t count = deques_.size();
+    std::size_t start = nextRandom() % count;
+    for (std::size_t k = 0; k < count; ++k) {
+        std::size_t victim = (start + k) % count;
+        if (worker && victim == t_worker) {
+            continue;
+        }
+        if (Task* task = deques_[victim]->steal()) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void ThreadPool::execute(Task* task) {
+    TaskGroup* group = task->group;
+    task->run(task);
+    group->pending_.fetch_sub(1, std::memory_order_release);
+}
+
+void ThreadPool::workerLoop(unsigned index) {
+    t_pool = this;
+    t_worker = index;
+    t_random = 0x9e3779b9u * (index + 1);
+
+    unsigned idle = 0;
+    for (;;) {
+        std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+        if (Task* task = findTask()) {
+            execute(task);
+            idle = 0;
+            continue;
+        }
+        if (++idle < kIdleSpins) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        if (stopping_) {
+            return;
+        }
+        sleeping_.fetch_add(1, std::memory_order_seq_cst);
+        wake_.wait(lock, [&] { return stopping_ || epoch_.load(std::memory_order_seq_cst) != epoch; });
+        sleeping_.fetch_sub(1, std::memory_order_relaxed);
+        if (stopping_) {
+            return;
+        }
+        idle = 0;
+    }
+}
+
+void ThreadPool::notifyWorkers() {
+    epoch_.fetch_add(1, std::memory_order_seq_cst);
+    if (sleeping_.load(std::memory_order_seq_cst) != 0) {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        wake_.notify_one();
+    }
+}
@@ -0,0 +1,202 @@
+/**
+ * @file ThreadPool.hpp
+ * @brief This file contains the declaration of the ThreadPool class, a work-stealing scheduler for per-order and per-dish work.
+ *
+ * Every worker owns a fixed-size deque of tasks (a Chase-Lev deque): it pushes and pops new tasks at the
+ * bottom without locking, and idle workers steal the oldest task from the top of another worker's deque.
+ * Tasks spawned by threads outside the pool go through one shared injection queue. A worker that finds no
+ * task spins briefly and then sleeps until a task is pushed.
+ *
+ * Tasks are grouped in a TaskGroup; TaskGroup::wait() runs or steals tasks until every task of the group has
+ * finished, so a task may spawn and wait for subtasks without blocking a worker. parallelFor() splits a
+ * range in halves down to a grain size, so most of the work is spawned by the workers themselves and
+ * stealing moves large halves rather than single items. Tasks must not throw.
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class ThreadPool {
+public:
+    class TaskGroup;
+
+    // Task definition, the type-erased base of every closure the pool runs
+    struct Task {
+        void (*run)(Task* task);    // runs the closure and deletes the task
+        TaskGroup* group;
+    };
+
+    /**
+     * A set of tasks that can be waited for together.
+     * The destructor waits for the tasks that are still running.
+     */
+    class TaskGroup {
+    public:
+        /**
+         * @param pool A reference to the pool the tasks run on, which must outlive the group.
+         */
+        explicit TaskGroup(ThreadPool& pool) : pool_(pool), pending_(0) {
+        }
+
+        ~TaskGroup() {
+            wait();
+        }
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        /**
+         * Spawns a task. It runs on a worker, or on a thread waiting for a group.
+         * @param function The function to run, called without arguments.
+         */
+        template <typename Function>
+        void run(Function&& function);
+
+        /**
+         * Runs tasks of the pool until every task of the group has finished.
+         */
+        void wait();
+
+    private:
+        friend class ThreadPool;
+
+        ThreadPool& pool_;
+        std::atomic<std::size_t> pending_;
+    };
+
+    /**
+     * Parameterized constructor.
+     * @param worker_count The number of worker threads, 0 uses std::thread::hardware_concurrency().
+     */
+    explicit ThreadPool(unsigned worker_count = 0);
+
+    /**
+     * Destructor.
+     * Stops the workers; every task group must have been waited for.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @return The number of worker threads.
+     */
+    unsigned workerCount() const;
+
+    /**
+     * Calls body(first, last) on sub-ranges that cover [begin, end) and returns once all calls are done.
+     * The calling thread takes part in the work.
+     * @param begin The first index.
+     * @param end One past the last index.
+     * @param grain The largest sub-range not split further, 0 picks one that gives each worker about 8 ranges.
+     * @param body The function called on each sub-range, from several threads at once.
+     */
+    template <typename Body>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, const Body& body);
+
+private:
+    // Fixed-size Chase-Lev deque; the owner pushes and pops at the bottom, other threads steal at the top
+    class WorkDeque {
+    public:
+        WorkDeque();
+
+        bool push(Task* task);      // false if the deque is full
+        Task* pop();
+        Task* steal();
+
+    private:
+        static const std::int64_t kCapacity = 4096;
+
+        alignas(64) std::atomic<std::int64_t> top_;
+        alignas(64) std::atomic<std::int64_t> bottom_;
+        std::unique_ptr<std::atomic<Task*>[]> buffer_;
+    };
+
+    template <typename Function>
+    struct Closure : Task {
+        Function function;
+
+        explicit Closure(Function&& f) : function(std::move(f)) {
+        }
+
+        static void invoke(Task* task) {
+            Closure* closure = static_cast<Closure*>(task);
+            closure->function();
+            delete closure;
+        }
+    };
+
+    template <typename Body>
+    void splitRange(TaskGroup& group, std::size_t begin, std::size_t end, std::size_t grain, const Body& body);
+
+    void spawn(Task* task);
+    Task* findTask();
+    static void execute(Task* task);
+    void workerLoop(unsigned index);
+    void notifyWorkers();
+
+    std::vector<std::unique_ptr<WorkDeque>> deques_;   // by worker
+    std::vector<std::thread> workers_;
+    std::mutex injection_mutex_;
+    std::deque<Task*> injection_;                       // tasks spawned outside the pool
+    std::atomic<std::size_t> injection_size_;
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    std::atomic<std::uint64_t> epoch_;                  // bumped whenever a task is spawned
+    std::atomic<unsigned> sleeping_;
+    bool stopping_;                                     // guarded by sleep_mutex_
+};
+
+// Template Functions
+template <typename Function>
+void ThreadPool::TaskGroup::run(Function&& function) {
+    using Stored = typename std::decay<Function>::type;
+    Closure<Stored>* task = new Closure<Stored>(Stored(std::forward<Function>(function)));
+    task->run = &Closure<Stored>::invoke;
+    task->group = this;
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    pool_.spawn(task);
+}
+
+template <typename Body>
+void ThreadPool::parallelFor(std::size_t begin, std::size_t end, std::size_t grain, const Body& body) {
+    if (end <= begin) {
+        return;
+    }
+    if (grain == 0) {
+        grain = std::max<std::size_t>(1, (end - begin) / (std::size_t(workerCount()) * 8));
+    }
+    TaskGroup group(*this);
+    splitRange(group, begin, end, grain, body);
+    group.wait();
+}
+
+template <typename Body>
+void ThreadPool::splitRange(TaskGroup& group, std::size_t begin, std::size_t end, std::size_t grain, const Body& body) {
+    // Spawn the upper halves and keep the lowest sub-range for this thread
+    while (end - begin > grain) {
+        std::size_t middle = begin + (end - begin) / 2;
+        group.run([this, &group, middle, end, grain, &body] { splitRange(group, middle, end, grain, body); });
+        end = middle;
+    }
+    body(begin, end);
+}
+
+#endif // THREAD_POOL_HPP
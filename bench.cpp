@@ -0,0 +1,2788 @@
+/**
+ * @file bench.cpp
+ * @brief This file contains the benchmark program for the Dish hierarchy and the containers built on it.
+ *
+ * Each benchmark builds a synthetic menu, times one operation with std::chrono and prints the result.
+ * The number of dishes can be passed as the first command line argument. The other arguments are
+ *   --filter TEXT       run only the benchmarks whose name contains TEXT (see kBenchmarks)
+ *   --repetitions N     timed runs of every measure() benchmark, the median is reported (default 5)
+ *   --warmup N          untimed runs before them (default 1)
+ *   --json FILE         also write every result to FILE as JSON
+ *   --no-counters       do not read hardware performance counters (see PerfCounters)
+ *
+ * @date October 16th, 2026
+ * @author Kun Feng Wei
+ */
+
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "Dessert.hpp"
+#include "MainCourse.hpp"
+#include "DishCatalog.hpp"
+#include "DishFilter.hpp"
+#include "DishEnums.hpp"
+#include "NameValidation.hpp"
+#include "AttributeFilter.hpp"
+#include "MenuRenderer.hpp"
+#include "MenuFile.hpp"
+#include "Menu.hpp"
+#include "MenuImporter.hpp"
+#include "IngredientIndex.hpp"
+#include "OrderedIndex.hpp"
+#include "KitchenSimulation.hpp"
+#include "ThreadPool.hpp"
+#include "OrderTicket.hpp"
+#include "ConcurrentMenu.hpp"
+#include "MenuStatistics.hpp"
+#include "PerfCounters.hpp"
+#include "DishInstrumentation.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>   // For open
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <queue>
+#include <random>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <unistd.h>  // For close
+#ifdef __GLIBC__
+#include <malloc.h>  // For malloc_trim
+#endif
+
+// Global allocation counter, every operator new in the program goes through it
+static std::atomic<std::size_t> g_allocations(0);
+
+// None of the replacements is inlined, so the compiler does not pair malloc and free across them
+__attribute__((noinline)) void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* block = std::malloc(size == 0 ? 1 : size)) {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void* block) noexcept {
+    std::free(block);
+}
+
+__attribute__((noinline)) void operator delete(void* block, std::size_t) noexcept {
+    std::free(block);
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Returns the number of nanoseconds elapsed since start
+double elapsedNs(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// Settings from the command line
+struct Settings {
+    std::size_t repetitions = 5;
+    std::size_t warmups = 1;
+    bool counters = true;
+};
+
+Settings& settings() {
+    static Settings settings;
+    return settings;
+}
+
+// The hardware counters measure() reads, opened by main() unless --no-counters is given
+PerfCounters& perfCounters() {
+    static PerfCounters counters;
+    return counters;
+}
+
+// JSON keys of the PerfCounters events
+const char* const kCounterKeys[PerfCounters::kEventCount] = {"cycles", "instructions", "l1d_read_misses", "llc_misses", "branch_misses"};
+
+// One reported result, kept for the JSON file
+struct Result {
+    std::string name;
+    std::string unit;               // "op" or "byte"
+    std::size_t ops;
+    std::size_t repetitions;
+    double total_ns;                // of the reported repetition
+    double ns_per_op;
+    double min_ns_per_op;
+    double max_ns_per_op;
+    PerfCounters::Counts counters;  // summed over the timed repetitions, none for report()
+};
+
+std::vector<Result>& recordedResults() {
+    static std::vector<Result> results;
+    return results;
+}
+
+// The number of failed checks, main() exits with an error when it is not zero
+std::size_t& failedChecks() {
+    static std::size_t failed = 0;
+    return failed;
+}
+
+// Counts a failed check and starts its line, the caller prints the details and the end of the line
+std::ostream& mismatch() {
+    ++failedChecks();
+    return std::cout << "MISMATCH: ";
+}
+
+// Prints one result line
+void report(const std::string& name, double total_ns, std::size_t ops) {
+    std::cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << total_ns / 1e6 << " ms" << std::setw(12) << total_ns / ops << " ns/op" << std::endl;
+    double ns_per_op = total_ns / ops;
+    recordedResults().push_back(Result{name, "op", ops, 1, total_ns, ns_per_op, ns_per_op, ns_per_op});
+}
+
+// Prints IPC and the misses per operation of the counters that were read
+void reportCounters(const PerfCounters::Counts& counts, double ops) {
+    using Event = PerfCounters::Event;
+    if (!counts.has(Event::CYCLES) && !counts.has(Event::INSTRUCTIONS) && !counts.has(Event::L1D_READ_MISSES) &&
+        !counts.has(Event::LLC_MISSES) && !counts.has(Event::BRANCH_MISSES)) {
+        return;
+    }
+    std::cout << "  " << std::fixed << std::setprecision(2);
+    if (counts.has(Event::CYCLES)) {
+        std::cout << counts[Event::CYCLES] / ops << " cycles/op";
+    }
+    if (counts.ipc() != 0.0) {
+        std::cout << ", IPC " << counts.ipc();
+    }
+    std::cout << std::setprecision(3);
+    for (Event event : {Event::L1D_READ_MISSES, Event::LLC_MISSES, Event::BRANCH_MISSES}) {
+        if (counts.has(event)) {
+            std::cout << ", " << counts[event] / ops << " " << PerfCounters::eventName(event) << "/op";
+        }
+    }
+    std::cout << std::endl;
+}
+
+// Runs the body settings().warmups times untimed and settings().repetitions times timed, and reports the
+// median repetition and, when they can be read, the hardware counters over every timed repetition. The
+// body returns a checksum so the compiler cannot drop its work.
+template <typename Body>
+void measure(const std::string& name, std::size_t ops, Body&& body) {
+    static volatile std::size_t sink = 0;
+    for (std::size_t w = 0; w < settings().warmups; ++w) {
+        sink = sink + body();
+    }
+    PerfCounters& counters = perfCounters();
+    PerfCounters::Counts counts;
+    std::vector<double> samples;
+    for (std::size_t r = 0; r < std::max<std::size_t>(settings().repetitions, 1); ++r) {
+        counters.start();
+        Clock::time_point start = Clock::now();
+        sink = sink + body();
+        samples.push_back(elapsedNs(start));
+        PerfCounters::Counts repetition = counters.stop();
+        if (r == 0) {
+            counts = repetition;
+        } else {
+            counts.add(repetition);
+        }
+    }
+    std::sort(samples.begin(), samples.end());
+    double median = samples[samples.size() / 2];
+    std::cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << median / 1e6 << " ms" << std::setw(12) << median / ops << " ns/op"
+              << "  (" << samples.front() / ops << " - " << samples.back() / ops << ")" << std::endl;
+    reportCounters(counts, static_cast<double>(ops) * samples.size());
+    recordedResults().push_back(Result{name, "op", ops, samples.size(), median, median / ops, samples.front() / ops, samples.back() / ops, counts});
+}
+
+// Writes a string as a JSON string literal
+void writeJsonString(std::ostream& out, const std::string& text) {
+    out << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+// Writes every recorded result to a JSON file
+bool writeJson(const std::string& path, std::size_t count, std::string& error) {
+    std::ofstream out(path);
+    if (!out) {
+        error = "cannot open " + path;
+        return false;
+    }
+    out << std::setprecision(17) << "{\n  \"dishes\": " << count << ",\n  \"repetitions\": " << settings().repetitions
+        << ",\n  \"warmups\": " << settings().warmups << ",\n  \"counters\": " << (perfCounters().isOpen() ? "true" : "false")
+        << ",\n  \"results\": [";
+    const std::vector<Result>& results = recordedResults();
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+        out << (i == 0 ? "\n" : ",\n") << "    {\"name\": ";
+        writeJsonString(out, result.name);
+        out << ", \"unit\": \"" << result.unit << "\", \"ops\": " << result.ops << ", \"repetitions\": " << result.repetitions
+            << ", \"total_ns\": " << result.total_ns << ", \"ns_per_op\": " << result.ns_per_op
+            << ", \"min_ns_per_op\": " << result.min_ns_per_op << ", \"max_ns_per_op\": " << result.max_ns_per_op;
+        double counted_ops = static_cast<double>(result.ops) * result.repetitions;
+        for (std::size_t e = 0; e < PerfCounters::kEventCount; ++e) {
+            if (result.counters.valid[e]) {
+                out << ", \"" << kCounterKeys[e] << "_per_op\": " << result.counters.values[e] / counted_ops;
+            }
+        }
+        if (result.counters.ipc() != 0.0) {
+            out << ", \"ipc\": " << result.counters.ipc();
+        }
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+    if (!out) {
+        error = "cannot write " + path;
+        return false;
+    }
+    return true;
+}
+
+// Returns the resident set size of the process in kilobytes, or 0 if it cannot be read
+long residentKb() {
+    std::ifstream status("/proc/self/status");
+    std::string key;
+    while (status >> key) {
+        if (key == "VmRSS:") {
+            long kb = 0;
+            status >> kb;
+            return kb;
+        }
+        status.ignore(4096, '\n');
+    }
+    return 0;
+}
+
+// Resets the peak resident set size of the process (Linux 4.0 and later)
+void resetPeakResident() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+}
+
+// Returns the peak resident set size of the process in kilobytes since the last reset, or 0 if it cannot be read
+long peakResidentKb() {
+    std::ifstream status("/proc/self/status");
+    std::string key;
+    while (status >> key) {
+        if (key == "VmHWM:") {
+            long kb = 0;
+            status >> kb;
+            return kb;
+        }
+        status.ignore(4096, '\n');
+    }
+    return 0;
+}
+
+// Returns freed heap memory to the system so the next RSS reading starts from a clean baseline
+void releaseFreedMemory() {
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+}
+
+// Synthetic menu data
+const std::vector<std::string> kIngredients = {"Garlic", "Olive Oil", "Chicken", "Rosemary", "Flour", "Sugar",
+                                               "Cocoa Powder", "Eggs", "Tomato", "Basil", "Rice", "Peanuts"};
+
+const std::vector<std::string> kNames = {"Grilled Chicken", "Chocolate Cake", "Garlic Bread", "Pad Thai",
+                                         "Caesar Salad", "Beef Tacos", "Tiramisu", "Spring Rolls"};
+
+std::vector<std::string> makeIngredients(std::size_t i) {
+    std::vector<std::string> ingredients;
+    for (std::size_t k = 0; k < 3 + i % 6; ++k) {
+        ingredients.push_back(kIngredients[(i + k * 5) % kIngredients.size()]);
+    }
+    return ingredients;
+}
+
+Dish makeDish(std::size_t i) {
+    return Dish(kNames[i % kNames.size()], makeIngredients(i), static_cast<int>(5 + i % 55),
+                4.99 + static_cast<double>(i % 40), static_cast<Dish::CuisineType>(i % 7));
+}
+
+Appetizer makeAppetizer(std::size_t i) {
+    return Appetizer(kNames[i % kNames.size()], makeIngredients(i), static_cast<int>(5 + i % 25),
+                     3.99 + static_cast<double>(i % 12), static_cast<Dish::CuisineType>(i % 7),
+                     static_cast<Appetizer::ServingStyle>(i % 3), static_cast<int>(i % 10), i % 2 == 0);
+}
+
+MainCourse makeMainCourse(std::size_t i) {
+    std::vector<MainCourse::SideDish> side_dishes;
+    for (std::size_t k = 0; k < i % 4; ++k) {
+        side_dishes.push_back({"Green Beans", static_cast<MainCourse::Category>((i + k) % 8)});
+    }
+    return MainCourse(kNames[i % kNames.size()], makeIngredients(i), static_cast<int>(15 + i % 45),
+                      12.99 + static_cast<double>(i % 30), static_cast<Dish::CuisineType>(i % 7),
+                      static_cast<MainCourse::CookingMethod>(i % 5), "Chicken", side_dishes, i % 3 == 0);
+}
+
+Dessert makeDessert(std::size_t i) {
+    return Dessert(kNames[i % kNames.size()], makeIngredients(i), static_cast<int>(10 + i % 50),
+                   5.99 + static_cast<double>(i % 10), static_cast<Dish::CuisineType>(i % 7),
+                   static_cast<Dessert::FlavorProfile>(i % 5), static_cast<int>(i % 11), i % 4 == 0);
+}
+
+// Builds a catalog with appetizers, main courses and desserts in equal parts
+DishCatalog makeCatalog(std::size_t count) {
+    DishCatalog catalog;
+    catalog.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        switch (i % 3) {
+            case 0: catalog.add(makeAppetizer(i)); break;
+            case 1: catalog.add(makeMainCourse(i)); break;
+            default: catalog.add(makeDessert(i)); break;
+        }
+    }
+    return catalog;
+}
+
+// Compares a "price under X and cuisine is ITALIAN" scan over Dish objects and over catalog columns
+void benchCatalogScan(std::size_t count) {
+    std::vector<Dish> dishes;
+    dishes.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        dishes.push_back(makeDish(i));
+    }
+    DishCatalog catalog;
+    catalog.reserve(count);
+    for (const Dish& dish : dishes) {
+        catalog.add(dish);
+    }
+
+    const double max_price = 20.0;
+    std::size_t baseline_hits = 0;
+    std::size_t catalog_hits = 0;
+
+    // One op is one dish; the counters show the cache misses of reading price and cuisine from whole dishes
+    measure("scan std::vector<Dish>", count, [&] {
+        baseline_hits = 0;
+        for (const Dish& dish : dishes) {
+            if (dish.getPrice() < max_price && dish.getCuisineTypeEnum() == Dish::CuisineType::ITALIAN) {
+                ++baseline_hits;
+            }
+        }
+        return baseline_hits;
+    });
+
+    measure("scan DishCatalog columns", count, [&] {
+        catalog_hits = 0;
+        const double* prices = catalog.prices();
+        const Dish::CuisineType* cuisine_types = catalog.cuisineTypes();
+        for (std::size_t i = 0; i < catalog.size(); ++i) {
+            catalog_hits += (prices[i] < max_price) & (cuisine_types[i] == Dish::CuisineType::ITALIAN);
+        }
+        return catalog_hits;
+    });
+
+    if (baseline_hits != catalog_hits) {
+        mismatch() << baseline_hits << " vs " << catalog_hits << std::endl;
+    }
+}
+
+// Compares the menu-compliance filters done with per-object getters against the vectorized kernels
+void benchFilterKernels(std::size_t count) {
+    std::vector<Appetizer> appetizers;
+    std::vector<Dessert> desserts;
+    DishCatalog catalog;
+    catalog.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (i % 2 == 0) {
+            appetizers.push_back(makeAppetizer(i));
+            catalog.add(appetizers.back());
+        } else {
+            desserts.push_back(makeDessert(i));
+            catalog.add(desserts.back());
+        }
+    }
+
+    const double max_price = 9.0;
+    const int max_prep_time = 20;
+    const int repetitions = 10;
+
+    // price < p and prep_time <= t and (spiciness >= 5 or 3 <= sweetness <= 7)
+    std::size_t baseline_hits = 0;
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        baseline_hits = 0;
+        for (const Appetizer& appetizer : appetizers) {
+            baseline_hits += appetizer.getPrice() < max_price && appetizer.getPrepTime() <= max_prep_time &&
+                             appetizer.getSpicinessLevel() >= 5;
+        }
+        for (const Dessert& dessert : desserts) {
+            baseline_hits += dessert.getPrice() < max_price && dessert.getPrepTime() <= max_prep_time &&
+                             dessert.getSweetnessLevel() >= 3 && dessert.getSweetnessLevel() <= 7;
+        }
+    }
+    report("filter per-object getters", elapsedNs(start), count * repetitions);
+
+    const DishFilter::Isa isas[] = {DishFilter::Isa::SCALAR, DishFilter::Isa::SSE2, DishFilter::Isa::AVX2};
+    for (DishFilter::Isa requested : isas) {
+        DishFilter::Isa isa = DishFilter::setIsa(requested);
+        if (isa != requested) {
+            continue;
+        }
+        std::size_t kernel_hits = 0;
+        start = Clock::now();
+        for (int r = 0; r < repetitions; ++r) {
+            DishFilter::Bitmap selection = DishFilter::priceLessThan(catalog, max_price);
+            DishFilter::intersect(selection, DishFilter::prepTimeAtMost(catalog, max_prep_time));
+            DishFilter::Bitmap levels = DishFilter::spicinessAtLeast(catalog, 5);
+            DishFilter::unite(levels, DishFilter::sweetnessBetween(catalog, 3, 7));
+            DishFilter::intersect(selection, levels);
+            kernel_hits = DishFilter::count(selection);
+        }
+        report(std::string("filter DishFilter kernels (") + DishFilter::isaName(isa) + ")", elapsedNs(start),
+               count * repetitions);
+        if (kernel_hits != baseline_hits) {
+            mismatch() << baseline_hits << " vs " << kernel_hits << std::endl;
+        }
+    }
+    DishFilter::setIsa(DishFilter::Isa::AVX2);
+}
+
+// Compares a dietary filter over a mixed menu done with per-class getters, with the attribute word of
+// each object and with the attribute column kernels
+void benchAttributeFilter(std::size_t count) {
+    std::vector<Appetizer> appetizers;
+    std::vector<MainCourse> main_courses;
+    std::vector<Dessert> desserts;
+    appetizers.reserve(count / 3 + 1);
+    main_courses.reserve(count / 3 + 1);
+    desserts.reserve(count / 3 + 1);
+    DishCatalog catalog;
+    catalog.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        switch (i % 3) {
+            case 0: appetizers.push_back(makeAppetizer(i)); catalog.add(appetizers.back()); break;
+            case 1: main_courses.push_back(makeMainCourse(i)); catalog.add(main_courses.back()); break;
+            default: desserts.push_back(makeDessert(i)); catalog.add(desserts.back()); break;
+        }
+    }
+
+    // The menu in catalog order, as a mixed list of dishes tagged with their course
+    std::vector<std::pair<Dish::Course, const Dish*>> menu;
+    menu.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        switch (i % 3) {
+            case 0: menu.emplace_back(Dish::Course::APPETIZER, &appetizers[i / 3]); break;
+            case 1: menu.emplace_back(Dish::Course::MAIN_COURSE, &main_courses[i / 3]); break;
+            default: menu.emplace_back(Dish::Course::DESSERT, &desserts[i / 3]); break;
+        }
+    }
+
+    // Italian and (vegetarian appetizer or gluten-free main course or nut-free dessert)
+    const AttributeFilter filters[] = {
+        AttributeFilter().cuisineType(Dish::CuisineType::ITALIAN).vegetarian(true),
+        AttributeFilter().cuisineType(Dish::CuisineType::ITALIAN).glutenFree(true),
+        AttributeFilter().cuisineType(Dish::CuisineType::ITALIAN).containsNuts(false),
+    };
+    const int repetitions = 10;
+
+    std::size_t baseline_hits = 0;
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        baseline_hits = 0;
+        for (const auto& entry : menu) {
+            if (entry.second->getCuisineTypeEnum() != Dish::CuisineType::ITALIAN) {
+                continue;
+            }
+            switch (entry.first) {
+                case Dish::Course::APPETIZER:
+                    baseline_hits += static_cast<const Appetizer*>(entry.second)->isVegetarian();
+                    break;
+                case Dish::Course::MAIN_COURSE:
+                    baseline_hits += static_cast<const MainCourse*>(entry.second)->isGlutenFree();
+                    break;
+                case Dish::Course::DESSERT:
+                    baseline_hits += !static_cast<const Dessert*>(entry.second)->containsNuts();
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    report("dietary filter downcast + branch", elapsedNs(start), count * repetitions);
+
+    std::size_t object_hits = 0;
+    start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        object_hits = 0;
+        for (const auto& entry : menu) {
+            std::uint32_t attributes = entry.second->getAttributes();
+            object_hits += filters[0].matches(attributes) | filters[1].matches(attributes) | filters[2].matches(attributes);
+        }
+    }
+    report("dietary filter attribute word", elapsedNs(start), count * repetitions);
+    if (object_hits != baseline_hits) {
+        mismatch() << baseline_hits << " vs " << object_hits << std::endl;
+    }
+
+    const DishFilter::Isa isas[] = {DishFilter::Isa::SCALAR, DishFilter::Isa::SSE2, DishFilter::Isa::AVX2};
+    for (DishFilter::Isa requested : isas) {
+        DishFilter::Isa isa = DishFilter::setIsa(requested);
+        if (isa != requested) {
+            continue;
+        }
+        std::size_t kernel_hits = 0;
+        start = Clock::now();
+        for (int r = 0; r < repetitions; ++r) {
+            DishFilter::Bitmap selection = DishFilter::attributesMatch(catalog, filters[0]);
+            DishFilter::unite(selection, DishFilter::attributesMatch(catalog, filters[1]));
+            DishFilter::unite(selection, DishFilter::attributesMatch(catalog, filters[2]));
+            kernel_hits = DishFilter::count(selection);
+        }
+        report(std::string("dietary filter attribute column (") + DishFilter::isaName(isa) + ")", elapsedNs(start),
+               count * repetitions);
+        if (kernel_hits != baseline_hits) {
+            mismatch() << baseline_hits << " vs " << kernel_hits << std::endl;
+        }
+    }
+    DishFilter::setIsa(DishFilter::Isa::AVX2);
+}
+
+// The linear label search the importer used before the DishEnums tables, kept as the baseline
+template <typename Enum, std::size_t N>
+bool linearParse(std::string_view text, const char* const (&labels)[N], Enum& value) {
+    for (std::size_t i = 0; i < N; ++i) {
+        if (text == labels[i]) {
+            value = static_cast<Enum>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Compares parsing side dish categories with a linear search, a hash map and the perfect-hash table
+void benchEnumParsing(std::size_t count) {
+    static const char* const kLabels[] = {"GRAIN", "PASTA", "LEGUME", "BREAD", "SALAD", "SOUP", "STARCHES", "VEGETABLE"};
+    std::vector<std::string> feed;
+    feed.reserve(count);
+    std::mt19937 random(7);
+    for (std::size_t i = 0; i < count; ++i) {
+        feed.push_back(kLabels[random() % 8]);
+    }
+    std::unordered_map<std::string_view, MainCourse::Category> map;
+    for (std::size_t i = 0; i < 8; ++i) {
+        map.emplace(kLabels[i], static_cast<MainCourse::Category>(i));
+    }
+
+    const int repetitions = 10;
+    std::size_t linear_sum = 0;
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        for (const std::string& text : feed) {
+            MainCourse::Category category = MainCourse::GRAIN;
+            linearParse(text, kLabels, category);
+            linear_sum += category;
+        }
+    }
+    report("parse category, linear search", elapsedNs(start), count * repetitions);
+
+    std::size_t map_sum = 0;
+    start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        for (const std::string& text : feed) {
+            auto found = map.find(text);
+            map_sum += found != map.end() ? found->second : 0;
+        }
+    }
+    report("parse category, std::unordered_map", elapsedNs(start), count * repetitions);
+
+    std::size_t table_sum = 0;
+    start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        for (const std::string& text : feed) {
+            MainCourse::Category category = MainCourse::GRAIN;
+            DishEnums::parse(text, category);
+            table_sum += category;
+        }
+    }
+    report("parse category, perfect-hash table", elapsedNs(start), count * repetitions);
+
+    if (linear_sum != map_sum || linear_sum != table_sum) {
+        mismatch() << linear_sum << " vs " << map_sum << " vs " << table_sum << std::endl;
+    }
+}
+
+// The per-character locale check Dish::isValidName used before NameValidation, kept as the baseline
+std::size_t legacyFirstInvalid(std::string_view name) {
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        if (!std::isalpha(name[i]) && !std::isspace(name[i])) {
+            return i;
+        }
+    }
+    return NameValidation::kValid;
+}
+
+// Compares validating a batch of feed names with the per-character locale calls and with NameValidation
+void benchNameValidation(std::size_t count) {
+    static const char kLetters[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ   ";
+    std::mt19937 random(11);
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string name(4 + random() % 37, ' ');
+        for (char& c : name) {
+            c = kLetters[random() % (sizeof(kLetters) - 1)];
+        }
+        if (random() % 20 == 0) {
+            name[random() % name.size()] = static_cast<char>('0' + random() % 10);  // one name in 20 is invalid
+        }
+        names.push_back(std::move(name));
+    }
+
+    const int repetitions = 10;
+    std::vector<std::size_t> legacy_offsets(count);
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        for (std::size_t i = 0; i < count; ++i) {
+            legacy_offsets[i] = legacyFirstInvalid(names[i]);
+        }
+    }
+    report("validate names, std::isalpha/isspace", elapsedNs(start), count * repetitions);
+
+    std::vector<std::size_t> offsets(count);
+    std::size_t invalid = 0;
+    start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        invalid = NameValidation::validate(ArrayView<std::string>(names), offsets.data());
+    }
+    report("validate names, NameValidation batch", elapsedNs(start), count * repetitions);
+
+    if (offsets != legacy_offsets) {
+        mismatch() << "offsets differ from the std::isalpha/isspace check" << std::endl;
+    }
+    std::cout << "  (" << invalid << " invalid names)" << std::endl;
+}
+
+// Compares the resident memory of per-dish ingredient strings with interned ingredient ids
+void benchIngredientMemory(std::size_t count) {
+    releaseFreedMemory();
+    long before = residentKb();
+    {
+        // The layout Dish used before interning: one std::string per ingredient per dish
+        std::vector<std::vector<std::string>> string_lists;
+        string_lists.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            string_lists.push_back(makeIngredients(i));
+        }
+        std::cout << "ingredients as std::string per dish:   " << residentKb() - before << " KB" << std::endl;
+    }
+    releaseFreedMemory();
+    before = residentKb();
+    {
+        // The layout Dish uses now: one 32-bit id per ingredient per dish
+        SymbolTable& table = SymbolTable::ingredients();
+        std::vector<std::vector<SymbolTable::Id>> id_lists;
+        id_lists.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            std::vector<SymbolTable::Id> ids;
+            for (const std::string& ingredient : makeIngredients(i)) {
+                ids.push_back(table.intern(ingredient));
+            }
+            id_lists.push_back(std::move(ids));
+        }
+        std::cout << "ingredients as interned ids per dish:  " << residentKb() - before << " KB" << std::endl;
+    }
+    releaseFreedMemory();
+}
+
+// Checks that the view accessors read every attribute without allocating and compares them with the getters
+void benchViewAccessors(std::size_t count) {
+    std::vector<MainCourse> main_courses;
+    main_courses.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        main_courses.push_back(makeMainCourse(i));
+    }
+
+    std::size_t total_length = 0;
+    std::size_t allocations = g_allocations.load();
+    Clock::time_point start = Clock::now();
+    for (const MainCourse& main_course : main_courses) {
+        total_length += main_course.getName().size() + main_course.getProteinType().size();
+        for (const std::string& ingredient : main_course.getIngredients()) {
+            total_length += ingredient.size();
+        }
+        for (const MainCourse::SideDish& side_dish : main_course.getSideDishes()) {
+            total_length += side_dish.name.size();
+        }
+    }
+    double getter_ns = elapsedNs(start);
+    std::size_t getter_allocations = g_allocations.load() - allocations;
+
+    std::size_t view_length = 0;
+    allocations = g_allocations.load();
+    start = Clock::now();
+    for (const MainCourse& main_course : main_courses) {
+        view_length += main_course.getNameView().size() + main_course.getProteinTypeView().size();
+        for (std::size_t i = 0; i < main_course.getIngredientCount(); ++i) {
+            view_length += main_course.getIngredientView(i).size();
+        }
+        for (std::size_t i = 0; i < main_course.getSideDishCount(); ++i) {
+            view_length += main_course.getSideDishNameView(i).size();
+        }
+    }
+    double view_ns = elapsedNs(start);
+    std::size_t view_allocations = g_allocations.load() - allocations;
+
+    report("read attributes via getters", getter_ns, count);
+    std::cout << "  allocations: " << getter_allocations << std::endl;
+    report("read attributes via views", view_ns, count);
+    std::cout << "  allocations: " << view_allocations << (view_allocations == 0 ? " (OK)" : " (FAILED)") << std::endl;
+    if (view_allocations != 0) {
+        ++failedChecks();
+    }
+    if (total_length != view_length) {
+        mismatch() << total_length << " vs " << view_length << std::endl;
+    }
+}
+
+// Counts the allocations per constructed main course when the feed data is copied in and when it is handed over
+void benchConstructionAllocations(std::size_t count) {
+    const std::vector<std::string> ingredients = makeIngredients(0);
+    std::vector<MainCourse> main_courses;
+    main_courses.reserve(count);
+
+    // Copy path: the arguments stay alive after the call, as with the old const& signatures
+    std::size_t allocations = g_allocations.load();
+    Clock::time_point start = Clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string name = "Slow Roasted Chicken Thighs";
+        std::string protein_type = "Free Range Chicken";
+        std::vector<MainCourse::SideDish> side_dishes = {{"Roasted Garlic Mashed Potatoes", MainCourse::STARCHES},
+                                                         {"Buttered Green Beans", MainCourse::VEGETABLE}};
+        main_courses.emplace_back(name, ingredients, 30, 18.99, Dish::CuisineType::AMERICAN, MainCourse::GRILLED,
+                                  protein_type, side_dishes, true);
+    }
+    double copy_ns = elapsedNs(start);
+    double copy_allocations = static_cast<double>(g_allocations.load() - allocations) / count;
+    main_courses.clear();
+
+    // View path: names are read as views of the feed text, the side dish names are interned from the list
+    const std::string feed = "Slow Roasted Chicken Thighs,Free Range Chicken";
+    allocations = g_allocations.load();
+    start = Clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string_view name = std::string_view(feed).substr(0, 27);
+        std::string_view protein_type = std::string_view(feed).substr(28);
+        std::vector<MainCourse::SideDish> side_dishes = {{"Roasted Garlic Mashed Potatoes", MainCourse::STARCHES},
+                                                         {"Buttered Green Beans", MainCourse::VEGETABLE}};
+        main_courses.emplace_back(name, ingredients, 30, 18.99, Dish::CuisineType::AMERICAN,
+                                  MainCourse::GRILLED, protein_type, side_dishes, true);
+    }
+    double view_ns = elapsedNs(start);
+    double view_allocations = static_cast<double>(g_allocations.load() - allocations) / count;
+
+    report("construct MainCourse, copied arguments", copy_ns, count);
+    std::cout << "  allocations per dish: " << copy_allocations << std::endl;
+    report("construct MainCourse, string views", view_ns, count);
+    std::cout << "  allocations per dish: " << view_allocations << std::endl;
+}
+
+// Builds and tears down a menu of main courses
+template <typename Vector>
+void buildAndTearDown(Vector& main_courses, std::size_t count, double& build_ns, double& teardown_ns) {
+    const std::vector<std::string> ingredients = makeIngredients(3);
+    Clock::time_point start = Clock::now();
+    main_courses.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        main_courses.emplace_back("Slow Roasted Chicken Thighs", ingredients, 30, 18.99, Dish::CuisineType::AMERICAN,
+                                  MainCourse::GRILLED, "Free Range Chicken",
+                                  std::vector<MainCourse::SideDish>{{"Roasted Garlic Mashed Potatoes", MainCourse::STARCHES}},
+                                  true);
+    }
+    build_ns = elapsedNs(start);
+    start = Clock::now();
+    main_courses.clear();
+    main_courses.shrink_to_fit();
+    teardown_ns = elapsedNs(start);
+}
+
+// Compares building and tearing down a menu with the global allocator and with one monotonic arena
+void benchArenaAllocation(std::size_t count) {
+    double build_ns = 0;
+    double teardown_ns = 0;
+
+    releaseFreedMemory();
+    resetPeakResident();
+    long before = residentKb();
+    {
+        std::vector<MainCourse> main_courses;
+        buildAndTearDown(main_courses, count, build_ns, teardown_ns);
+    }
+    report("build menu, global allocator", build_ns, count);
+    report("tear down menu, global allocator", teardown_ns, count);
+    std::cout << "  peak RSS growth: " << peakResidentKb() - before << " KB" << std::endl;
+
+    releaseFreedMemory();
+    resetPeakResident();
+    before = residentKb();
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        std::pmr::vector<MainCourse> main_courses(&arena);
+        buildAndTearDown(main_courses, count, build_ns, teardown_ns);
+        Clock::time_point start = Clock::now();
+        arena.release();
+        teardown_ns += elapsedNs(start);
+    }
+    report("build menu, monotonic arena", build_ns, count);
+    report("tear down menu, monotonic arena", teardown_ns, count);
+    std::cout << "  peak RSS growth: " << peakResidentKb() - before << " KB" << std::endl;
+    releaseFreedMemory();
+}
+
+// The per-line std::endl output Dish::display() used before the renderer, kept as the baseline
+void legacyDisplay(std::ostream& out, const Dish& dish) {
+    out << "Dish Name: " << dish.getName() << std::endl;
+    out << "Ingredients: ";
+    std::vector<std::string> ingredients = dish.getIngredients();
+    for (std::size_t i = 0; i < ingredients.size(); ++i) {
+        out << ingredients[i];
+        if (i != ingredients.size() - 1) {
+            out << ", ";
+        }
+    }
+    out << std::endl;
+    out << "Preparation Time: " << dish.getPrepTime() << " minutes" << std::endl;
+    out << std::fixed << std::setprecision(2) << "Price: $" << dish.getPrice() << std::endl;
+    out << "Cuisine Type: " << dish.getCuisineType() << std::endl;
+}
+
+// Prints the throughput of one rendering run in MB/s
+void reportThroughput(const std::string& name, double total_ns, std::size_t bytes) {
+    std::cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << total_ns / 1e6 << " ms" << std::setw(12) << bytes / (total_ns / 1e9) / 1e6
+              << " MB/s" << std::endl;
+    double ns_per_byte = total_ns / bytes;
+    recordedResults().push_back(Result{name, "byte", bytes, 1, total_ns, ns_per_byte, ns_per_byte, ns_per_byte});
+}
+
+// Compares per-line flushed output with the buffered MenuRenderer
+void benchRendering(std::size_t count) {
+    std::vector<Dish> dishes;
+    dishes.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        dishes.push_back(makeDish(i));
+    }
+    DishCatalog catalog = makeCatalog(count);
+
+    std::string expected;
+    {
+        StringSink sink(expected);
+        MenuRenderer renderer(sink);
+        for (const Dish& dish : dishes) {
+            renderer.renderDish(dish);
+        }
+    }
+
+    std::ofstream null_stream("/dev/null");
+    Clock::time_point start = Clock::now();
+    for (const Dish& dish : dishes) {
+        legacyDisplay(null_stream, dish);
+    }
+    reportThroughput("render dishes, std::endl per line", elapsedNs(start), expected.size());
+
+    int fd = ::open("/dev/null", O_WRONLY);
+    start = Clock::now();
+    {
+        FdSink sink(fd);
+        MenuRenderer renderer(sink);
+        for (const Dish& dish : dishes) {
+            renderer.renderDish(dish);
+        }
+        renderer.flush();
+    }
+    reportThroughput("render dishes, MenuRenderer to fd", elapsedNs(start), expected.size());
+
+    std::string text;
+    start = Clock::now();
+    {
+        StringSink sink(text);
+        MenuRenderer renderer(sink);
+        for (const Dish& dish : dishes) {
+            renderer.renderDish(dish);
+        }
+    }
+    reportThroughput("render dishes, MenuRenderer to string", elapsedNs(start), text.size());
+
+    std::ostringstream legacy_text;
+    for (std::size_t i = 0; i < dishes.size() && i < 1000; ++i) {
+        legacyDisplay(legacy_text, dishes[i]);
+    }
+    if (expected.compare(0, legacy_text.str().size(), legacy_text.str()) != 0) {
+        mismatch() << "rendered text differs from display()" << std::endl;
+    }
+
+    start = Clock::now();
+    std::size_t catalog_bytes = 0;
+    {
+        FdSink sink(fd);
+        MenuRenderer renderer(sink);
+        renderer.renderCatalog(catalog);
+        renderer.flush();
+        catalog_bytes = renderer.bytesRendered();
+    }
+    reportThroughput("render mixed catalog, MenuRenderer to fd", elapsedNs(start), catalog_bytes);
+    ::close(fd);
+}
+
+// The virtual-dispatch menu the Menu container is compared against: every dish is boxed on its own behind
+// a base class with virtual functions, as a std::vector<std::unique_ptr<...>> menu would hold it
+class BoxedDish {
+public:
+    virtual ~BoxedDish() = default;
+    virtual const Dish& dish() const = 0;
+    virtual bool dietary() const = 0;
+    virtual void render(MenuRenderer& renderer) const = 0;
+};
+
+class BoxedAppetizer : public BoxedDish {
+public:
+    explicit BoxedAppetizer(Appetizer appetizer) : appetizer_(std::move(appetizer)) {}
+    const Dish& dish() const override { return appetizer_; }
+    bool dietary() const override { return appetizer_.isVegetarian(); }
+    void render(MenuRenderer& renderer) const override {
+        renderer.renderDish(appetizer_);
+        renderer.renderAppetizer(appetizer_);
+    }
+
+private:
+    Appetizer appetizer_;
+};
+
+class BoxedMainCourse : public BoxedDish {
+public:
+    explicit BoxedMainCourse(MainCourse main_course) : main_course_(std::move(main_course)) {}
+    const Dish& dish() const override { return main_course_; }
+    bool dietary() const override { return main_course_.isGlutenFree(); }
+    void render(MenuRenderer& renderer) const override {
+        renderer.renderDish(main_course_);
+        renderer.renderMainCourse(main_course_);
+    }
+
+private:
+    MainCourse main_course_;
+};
+
+class BoxedDessert : public BoxedDish {
+public:
+    explicit BoxedDessert(Dessert dessert) : dessert_(std::move(dessert)) {}
+    const Dish& dish() const override { return dessert_; }
+    bool dietary() const override { return !dessert_.containsNuts(); }
+    void render(MenuRenderer& renderer) const override {
+        renderer.renderDish(dessert_);
+        renderer.renderDessert(dessert_);
+    }
+
+private:
+    Dessert dessert_;
+};
+
+// The same dietary predicate as BoxedDish::dietary(), as a visitor over Menu items
+struct Dietary {
+    bool operator()(const Dish&) const { return false; }
+    bool operator()(const Appetizer& appetizer) const { return appetizer.isVegetarian(); }
+    bool operator()(const MainCourse& main_course) const { return main_course.isGlutenFree(); }
+    bool operator()(const Dessert& dessert) const { return !dessert.containsNuts(); }
+};
+
+// Runs the aggregate, filter and render passes over a boxed menu
+void runBoxedMenu(const std::string& name, const std::vector<std::unique_ptr<BoxedDish>>& boxed, int repetitions, int fd) {
+    double total = 0.0;
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        for (const auto& item : boxed) {
+            total += item->dish().getPrice();
+        }
+    }
+    report("aggregate price, " + name, elapsedNs(start), boxed.size() * repetitions);
+
+    std::size_t hits = 0;
+    start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        hits = 0;
+        for (const auto& item : boxed) {
+            hits += item->dietary();
+        }
+    }
+    report("filter dietary, " + name, elapsedNs(start), boxed.size() * repetitions);
+
+    start = Clock::now();
+    {
+        FdSink sink(fd);
+        MenuRenderer renderer(sink);
+        for (const auto& item : boxed) {
+            item->render(renderer);
+        }
+        renderer.flush();
+    }
+    report("render, " + name, elapsedNs(start), boxed.size());
+    std::cout << "  (checksum " << std::fixed << std::setprecision(2) << total << ", " << hits << " hits)" << std::endl;
+}
+
+// Compares aggregate, filter and render passes over a variant Menu and over boxed dishes behind virtual functions
+void benchMenuContainer(std::size_t count) {
+    Menu menu;
+    menu.reserve(count);
+    std::vector<std::unique_ptr<BoxedDish>> boxed;
+    boxed.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        switch (i % 3) {
+            case 0:
+                menu.add(makeAppetizer(i));
+                boxed.push_back(std::make_unique<BoxedAppetizer>(makeAppetizer(i)));
+                break;
+            case 1:
+                menu.add(makeMainCourse(i));
+                boxed.push_back(std::make_unique<BoxedMainCourse>(makeMainCourse(i)));
+                break;
+            default:
+                menu.add(makeDessert(i));
+                boxed.push_back(std::make_unique<BoxedDessert>(makeDessert(i)));
+                break;
+        }
+    }
+    std::cout << "sizeof(Menu::Item): " << sizeof(Menu::Item) << " bytes" << std::endl;
+
+    const int repetitions = 10;
+    int fd = ::open("/dev/null", O_WRONLY);
+
+    double total = 0.0;
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        total += menu.summarize().total_price;
+    }
+    report("aggregate price, Menu (variant)", elapsedNs(start), count * repetitions);
+
+    std::size_t hits = 0;
+    start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        hits = 0;
+        menu.visit([&hits](const auto& dish) { hits += Dietary()(dish); });
+    }
+    report("filter dietary, Menu (variant)", elapsedNs(start), count * repetitions);
+
+    start = Clock::now();
+    {
+        FdSink sink(fd);
+        MenuRenderer renderer(sink);
+        renderer.renderMenu(menu);
+        renderer.flush();
+    }
+    report("render, Menu (variant)", elapsedNs(start), count);
+    std::cout << "  (checksum " << std::fixed << std::setprecision(2) << total << ", " << hits << " hits)" << std::endl;
+
+    runBoxedMenu("unique_ptr + virtual", boxed, repetitions, fd);
+
+    // A menu edited over time: the boxes stay where they were allocated while the order changes
+    std::shuffle(boxed.begin(), boxed.end(), std::mt19937(42));
+    runBoxedMenu("unique_ptr + virtual, shuffled", boxed, repetitions, fd);
+    ::close(fd);
+}
+
+// Drops the page cache of a file so the next read comes from disk
+void evictFromPageCache(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        ::fdatasync(fd);
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+}
+
+// Sums the prices and counts the ingredients of every record, the first query run after loading a menu
+double firstQuery(const MenuFileReader& reader, std::size_t& ingredients) {
+    double total = 0.0;
+    for (std::size_t i = 0; i < reader.size(); ++i) {
+        MenuFileReader::Record record = reader[i];
+        total += record.getPrice();
+        ingredients += record.getIngredientCount();
+    }
+    return total;
+}
+
+// Compares building a menu from objects with opening a menu file, cold and warm
+void benchMenuFile(std::size_t count) {
+    const std::string path = "/tmp/bench_menu.bin";
+    std::string error;
+
+    Clock::time_point start = Clock::now();
+    DishCatalog catalog = makeCatalog(count);
+    report("startup: construct DishCatalog", elapsedNs(start), count);
+
+    start = Clock::now();
+    MenuFileWriter writer;
+    writer.add(catalog);
+    if (!writer.write(path, error)) {
+        std::cout << "menu file: " << error << std::endl;
+        return;
+    }
+    report("write menu file", elapsedNs(start), count);
+
+    double expected_total = 0.0;
+    for (std::size_t i = 0; i < catalog.size(); ++i) {
+        expected_total += catalog[i].getPrice();
+    }
+
+    for (int cold = 1; cold >= 0; --cold) {
+        if (cold) {
+            evictFromPageCache(path);
+        }
+        const std::string label = cold ? "cold" : "warm";
+        MenuFileReader reader;
+        start = Clock::now();
+        if (!reader.open(path, error)) {
+            std::cout << "menu file: " << error << std::endl;
+            return;
+        }
+        report("startup: open menu file (" + label + ")", elapsedNs(start), count);
+
+        start = Clock::now();
+        std::size_t ingredients = 0;
+        double total = firstQuery(reader, ingredients);
+        report("first query over menu file (" + label + ")", elapsedNs(start), count);
+        if (total != expected_total || reader.size() != catalog.size()) {
+            mismatch() << "menu file differs from the catalog" << std::endl;
+        }
+    }
+
+    MenuFileReader reader;
+    reader.open(path, error);
+    start = Clock::now();
+    bool valid = reader.verifyChecksum();
+    report("verify menu file checksum", elapsedNs(start), count);
+    if (!valid) {
+        mismatch() << "checksum of a freshly written menu file" << std::endl;
+    }
+    reader.close();
+    std::remove(path.c_str());
+}
+
+// Counts imported dishes and sums their prices without keeping them
+class CountingSink : public ImportSink {
+public:
+    void onDish(Dish&& dish) override { add(dish); }
+    void onAppetizer(Appetizer&& appetizer) override { add(appetizer); }
+    void onMainCourse(MainCourse&& main_course) override { add(main_course); }
+    void onDessert(Dessert&& dessert) override { add(dessert); }
+
+    std::size_t count = 0;
+    double total_price = 0.0;
+
+private:
+    void add(const Dish& dish) {
+        ++count;
+        total_price += dish.getPrice();
+    }
+};
+
+// Writes a catalog as a CSV or JSON-lines feed
+void writeFeed(const DishCatalog& catalog, MenuImporter::Format format, std::ostream& out) {
+    static const char* const kCourses[] = {"DISH", "APPETIZER", "MAIN_COURSE", "DESSERT"};
+    static const char* const kCuisines[] = {"ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"};
+    static const char* const kStyles[][5] = {{"", "", "", "", ""},
+                                             {"PLATED", "FAMILY_STYLE", "BUFFET", "", ""},
+                                             {"GRILLED", "BAKED", "FRIED", "STEAMED", "RAW"},
+                                             {"SWEET", "BITTER", "SOUR", "SALTY", "UMAMI"}};
+    static const char* const kCategoryNames[] = {"GRAIN", "PASTA", "LEGUME", "BREAD", "SALAD", "SOUP", "STARCHES", "VEGETABLE"};
+    static const char* const kStyleKeys[] = {"", "serving_style", "cooking_method", "flavor_profile"};
+    static const char* const kLevelKeys[] = {"", "spiciness_level", "", "sweetness_level"};
+    static const char* const kFlagKeys[] = {"", "vegetarian", "gluten_free", "contains_nuts"};
+
+    for (std::size_t i = 0; i < catalog.size(); ++i) {
+        DishCatalog::Row row = catalog[i];
+        int course = static_cast<int>(row.getCourse());
+        int style = course == 1   ? static_cast<int>(row.getServingStyle())
+                    : course == 2 ? static_cast<int>(row.getCookingMethod())
+                                  : static_cast<int>(row.getFlavorProfile());
+        int level = course == 1 ? row.getSpicinessLevel() : row.getSweetnessLevel();
+        bool flag = course == 1 ? row.isVegetarian() : course == 2 ? row.isGlutenFree() : row.containsNuts();
+        const char* flag_text = flag ? "true" : "false";
+        if (format == MenuImporter::Format::CSV) {
+            out << kCourses[course] << ',' << row.getName() << ',';
+            for (std::size_t k = 0; k < row.getIngredientCount(); ++k) {
+                out << (k ? ";" : "") << row.getIngredient(k);
+            }
+            out << ',' << row.getPrepTime() << ',' << row.getPrice() << ',' << kCuisines[static_cast<int>(row.getCuisineTypeEnum())]
+                << ',' << kStyles[course][style] << ',' << level << ',' << flag_text << ',' << row.getProteinType() << ',';
+            for (std::size_t k = 0; k < row.getSideDishCount(); ++k) {
+                out << (k ? ";" : "") << row.getSideDishName(k) << ':' << kCategoryNames[row.getSideDishCategory(k)];
+            }
+        } else {
+            out << "{\"course\":\"" << kCourses[course] << "\",\"name\":\"" << row.getName() << "\",\"ingredients\":[";
+            for (std::size_t k = 0; k < row.getIngredientCount(); ++k) {
+                out << (k ? ",\"" : "\"") << row.getIngredient(k) << '"';
+            }
+            out << "],\"prep_time\":" << row.getPrepTime() << ",\"price\":" << row.getPrice() << ",\"cuisine_type\":\""
+                << kCuisines[static_cast<int>(row.getCuisineTypeEnum())] << "\",\"" << kStyleKeys[course] << "\":\""
+                << kStyles[course][style] << "\",\"" << kLevelKeys[course] << "\":" << level << ",\"" << kFlagKeys[course]
+                << "\":" << flag_text;
+            if (course == 2) {
+                out << ",\"protein_type\":\"" << row.getProteinType() << "\",\"side_dishes\":[";
+                for (std::size_t k = 0; k < row.getSideDishCount(); ++k) {
+                    out << (k ? "," : "") << "{\"name\":\"" << row.getSideDishName(k) << "\",\"category\":\""
+                        << kCategoryNames[row.getSideDishCategory(k)] << "\"}";
+                }
+                out << ']';
+            }
+            out << '}';
+        }
+        out << '\n';
+    }
+}
+
+// Imports CSV and JSON-lines feeds with growing worker counts and reports throughput and peak memory
+void benchImport(std::size_t count) {
+    DishCatalog catalog = makeCatalog(count);
+    double expected_total = 0.0;
+    for (std::size_t i = 0; i < catalog.size(); ++i) {
+        expected_total += catalog[i].getPrice();
+    }
+
+    const MenuImporter::Format formats[] = {MenuImporter::Format::CSV, MenuImporter::Format::JSON_LINES};
+    for (MenuImporter::Format format : formats) {
+        const bool csv = (format == MenuImporter::Format::CSV);
+        const std::string path = csv ? "/tmp/bench_menu.csv" : "/tmp/bench_menu.jsonl";
+        {
+            std::ofstream out(path, std::ios::binary);
+            writeFeed(catalog, format, out);
+        }
+        std::size_t bytes = 0;
+        {
+            std::ifstream in(path, std::ios::binary | std::ios::ate);
+            bytes = static_cast<std::size_t>(in.tellg());
+        }
+
+        unsigned max_workers = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned workers = 1; workers <= max_workers; workers *= 2) {
+            MenuImporter::Options options;
+            options.format = format;
+            options.worker_count = workers;
+            MenuImporter importer(options);
+            CountingSink sink;
+            MenuImporter::Result result;
+            std::string error;
+
+            releaseFreedMemory();
+            resetPeakResident();
+            long before = residentKb();
+            Clock::time_point start = Clock::now();
+            importer.importFile(path, sink, result, error);
+            double ns = elapsedNs(start);
+
+            std::string name = std::string(csv ? "import CSV" : "import JSON lines") + ", " + std::to_string(workers) + " workers";
+            report(name, ns, count);
+            reportThroughput(name, ns, bytes);
+            std::cout << "  peak RSS growth: " << peakResidentKb() - before << " KB for a " << bytes / 1024 << " KB feed" << std::endl;
+            if (sink.count != count || result.rejected != 0 || sink.total_price < expected_total - 1e-3 * count ||
+                sink.total_price > expected_total + 1e-3 * count) {
+                mismatch() << "imported " << sink.count << ", rejected " << result.rejected << std::endl;
+            }
+        }
+        std::remove(path.c_str());
+    }
+}
+
+// Compares allergen queries answered by scanning ingredient lists with the inverted ingredient index
+void benchIngredientIndex(std::size_t count) {
+    std::vector<Appetizer> appetizers;
+    std::vector<MainCourse> main_courses;
+    std::vector<Dessert> desserts;
+    appetizers.reserve(count / 3 + 1);
+    main_courses.reserve(count / 3 + 1);
+    desserts.reserve(count / 3 + 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        switch (i % 3) {
+            case 0: appetizers.push_back(makeAppetizer(i)); break;
+            case 1: main_courses.push_back(makeMainCourse(i)); break;
+            default: desserts.push_back(makeDessert(i)); break;
+        }
+    }
+
+    Clock::time_point start = Clock::now();
+    IngredientIndex index;
+    for (Appetizer& appetizer : appetizers) {
+        index.add(appetizer);
+    }
+    for (MainCourse& main_course : main_courses) {
+        index.add(main_course);
+    }
+    for (Dessert& dessert : desserts) {
+        index.add(dessert);
+    }
+    report("build IngredientIndex", elapsedNs(start), count);
+
+    // "Contains garlic and chicken but no peanuts"
+    const int repetitions = 10;
+    std::size_t scan_hits = 0;
+    start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        auto matches = [](const Dish& dish) {
+            bool garlic = false;
+            bool chicken = false;
+            bool peanuts = false;
+            for (const std::string& ingredient : dish.getIngredients()) {
+                garlic |= (ingredient == "Garlic");
+                chicken |= (ingredient == "Chicken");
+                peanuts |= (ingredient == "Peanuts");
+            }
+            return garlic && chicken && !peanuts;
+        };
+        for (const Appetizer& dish : appetizers) scan_hits += matches(dish);
+        for (const MainCourse& dish : main_courses) scan_hits += matches(dish);
+        for (const Dessert& dish : desserts) scan_hits += matches(dish);
+    }
+    report("query scan, string compare per ingredient", elapsedNs(start), count * repetitions);
+
+    SymbolTable& table = SymbolTable::ingredients();
+    SymbolTable::Id garlic = table.intern("Garlic");
+    SymbolTable::Id chicken = table.intern("Chicken");
+    SymbolTable::Id peanuts = table.intern("Peanuts");
+    std::size_t id_hits = 0;
+    start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        auto matches = [&](const Dish& dish) {
+            return dish.hasIngredient(garlic) && dish.hasIngredient(chicken) && !dish.hasIngredient(peanuts);
+        };
+        for (const Appetizer& dish : appetizers) id_hits += matches(dish);
+        for (const MainCourse& dish : main_courses) id_hits += matches(dish);
+        for (const Dessert& dish : desserts) id_hits += matches(dish);
+    }
+    report("query scan, interned ids", elapsedNs(start), count * repetitions);
+
+    std::size_t index_hits = 0;
+    start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        const SymbolTable::Id all_of[] = {garlic, chicken};
+        RoaringBitmap result = index.withAllOf(all_of).subtract(index.withIngredient(peanuts));
+        index_hits += result.cardinality();
+    }
+    report("query IngredientIndex bitmaps", elapsedNs(start), count * repetitions);
+
+    // "Vegetarian appetizers or gluten-free mains, without peanuts"
+    std::size_t flag_hits = 0;
+    start = Clock::now();
+    for (int r = 0; r < repetitions; ++r) {
+        flag_hits += index.vegetarian().unite(index.glutenFree()).subtract(index.withIngredient(peanuts)).cardinality();
+    }
+    report("query IngredientIndex flags and ingredient", elapsedNs(start), count * repetitions);
+
+    if (scan_hits != index_hits || id_hits != index_hits) {
+        mismatch() << scan_hits << " vs " << id_hits << " vs " << index_hits << std::endl;
+    }
+    if (flag_hits == 0) {
+        mismatch() << "no dishes matched the flag query" << std::endl;
+    }
+    std::cout << "  posting list for garlic: " << index.withIngredient(garlic).cardinality() << " dishes in "
+              << index.withIngredient(garlic).memoryUsage() / 1024 << " KB" << std::endl;
+
+    // Incremental updates through the setters
+    std::vector<std::string> new_ingredients = {"Peanuts", "Sugar", "Flour"};
+    start = Clock::now();
+    for (Dessert& dessert : desserts) {
+        dessert.setIngredients(new_ingredients);
+        dessert.setContainsNuts(true);
+    }
+    report("setIngredients + setContainsNuts, indexed", elapsedNs(start), desserts.size());
+    if (index.containsNuts().cardinality() != desserts.size() ||
+        index.withIngredient(peanuts).intersect(index.ofCourse(DishCatalog::Course::DESSERT)).cardinality() != desserts.size()) {
+        mismatch() << "index missed a setter update" << std::endl;
+    }
+}
+
+// Compares price and preparation time queries answered by scanning and sorting with the ordered indexes
+void benchOrderedIndex(std::size_t count) {
+    std::vector<Appetizer> appetizers;
+    std::vector<MainCourse> main_courses;
+    std::vector<Dessert> desserts;
+    appetizers.reserve(count / 3 + 1);
+    main_courses.reserve(count / 3 + 1);
+    desserts.reserve(count / 3 + 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        switch (i % 3) {
+            case 0: appetizers.push_back(makeAppetizer(i)); break;
+            case 1: main_courses.push_back(makeMainCourse(i)); break;
+            default: desserts.push_back(makeDessert(i)); break;
+        }
+    }
+    std::vector<Dish*> dishes;
+    dishes.reserve(count);
+    for (Appetizer& dish : appetizers) dishes.push_back(&dish);
+    for (MainCourse& dish : main_courses) dishes.push_back(&dish);
+    for (Dessert& dish : desserts) dishes.push_back(&dish);
+
+    Clock::time_point start = Clock::now();
+    OrderedIndex index;
+    for (Dish* dish : dishes) {
+        index.add(*dish);
+    }
+    report("build OrderedIndex", elapsedNs(start), count);
+
+    // Spread the prices out in cents through the setters, which moves every dish in the index
+    std::mt19937 random(42);
+    start = Clock::now();
+    for (Dish* dish : dishes) {
+        dish->setPrice(dish->getPrice() + static_cast<double>(random() % 500) / 100.0);
+    }
+    report("setPrice, indexed", elapsedNs(start), count);
+
+    // "The 20 cheapest Italian main courses under 25 minutes"
+    OrderedIndex::Query cheapest;
+    cheapest.filter.cuisineType(Dish::CuisineType::ITALIAN).course(Dish::Course::MAIN_COURSE);
+    cheapest.max_prep_time = 24;
+    cheapest.limit = 20;
+    // "All desserts between $5 and $9"
+    OrderedIndex::Query range;
+    range.filter.course(Dish::Course::DESSERT);
+    range.min_price = 5.0;
+    range.max_price = 9.0;
+
+    auto scanAndSort = [&](const OrderedIndex::Query& query) {
+        std::vector<const Dish*> found;
+        for (const Dish* dish : dishes) {
+            if (query.filter.matches(*dish) && dish->getPrice() >= query.min_price && dish->getPrice() <= query.max_price &&
+                dish->getPrepTime() >= query.min_prep_time && dish->getPrepTime() <= query.max_prep_time) {
+                found.push_back(dish);
+            }
+        }
+        auto cheaper = [](const Dish* a, const Dish* b) { return a->getPrice() < b->getPrice(); };
+        std::size_t k = std::min(query.limit, found.size());
+        std::partial_sort(found.begin(), found.begin() + static_cast<std::ptrdiff_t>(k), found.end(), cheaper);
+        found.resize(k);
+        return found;
+    };
+    // Both sides list the same prices in the same order, equal prices may come in another order
+    auto samePrices = [&](const std::vector<const Dish*>& scanned, const std::vector<OrderedIndex::DishId>& indexed) {
+        if (scanned.size() != indexed.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < scanned.size(); ++i) {
+            if (scanned[i]->getPrice() != index.dish(indexed[i])->getPrice()) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    const OrderedIndex::Query* queries[] = {&cheapest, &range};
+    const char* names[] = {"top 20 Italian mains under 25 minutes", "desserts between $5 and $9"};
+    for (int q = 0; q < 2; ++q) {
+        const int repetitions = 5;
+        std::vector<const Dish*> scanned;
+        start = Clock::now();
+        for (int r = 0; r < repetitions; ++r) {
+            scanned = scanAndSort(*queries[q]);
+        }
+        report(std::string(names[q]) + ", scan + partial_sort", elapsedNs(start), count * repetitions);
+
+        std::vector<OrderedIndex::DishId> indexed;
+        start = Clock::now();
+        for (int r = 0; r < repetitions; ++r) {
+            indexed = index.byPrice(*queries[q]);
+        }
+        report(std::string(names[q]) + ", OrderedIndex", elapsedNs(start), count * repetitions);
+        std::cout << "  " << indexed.size() << " dishes" << std::endl;
+        if (!samePrices(scanned, indexed)) {
+            mismatch() << "the index and the scan disagree on " << names[q] << std::endl;
+        }
+    }
+
+    // The 10 quickest dishes of any cuisine merge every partition
+    OrderedIndex::Query quickest;
+    quickest.limit = 10;
+    start = Clock::now();
+    std::vector<OrderedIndex::DishId> quick = index.byPrepTime(quickest);
+    report("10 quickest dishes, OrderedIndex", elapsedNs(start), count);
+    for (std::size_t i = 1; i < quick.size(); ++i) {
+        if (index.dish(quick[i])->getPrepTime() < index.dish(quick[i - 1])->getPrepTime()) {
+            mismatch() << "byPrepTime is out of order" << std::endl;
+        }
+    }
+}
+
+// Runs the kitchen simulation over the same orders with one and several threads
+void benchKitchenSimulation(std::size_t count) {
+    Menu menu;
+    for (std::size_t i = 0; i < 60; ++i) {
+        switch (i % 3) {
+            case 0: menu.add(makeAppetizer(i)); break;
+            case 1: menu.add(makeMainCourse(i)); break;
+            default: menu.add(makeDessert(i)); break;
+        }
+    }
+
+    // A table orders up to one appetizer and one dessert per two mains, a new table arrives every 4 seconds
+    KitchenSimulation simulation(menu);
+    simulation.reserve(count, count * 4);
+    std::mt19937 random(7);
+    std::vector<std::uint32_t> items;
+    std::string error;
+    for (std::size_t o = 0; o < count; ++o) {
+        items.clear();
+        std::uint32_t mains = 1 + random() % 4;
+        for (std::uint32_t k = 0; k < mains; ++k) {
+            items.push_back(1 + 3 * (random() % 20));
+            if (k % 2 == 0 && random() % 2 == 0) {
+                items.push_back(3 * (random() % 20));
+            }
+            if (k % 2 == 0 && random() % 2 == 0) {
+                items.push_back(2 + 3 * (random() % 20));
+            }
+        }
+        if (!simulation.addOrder(static_cast<KitchenSimulation::Time>(o * 4), items, error)) {
+            mismatch() << error << std::endl;
+            return;
+        }
+    }
+
+    KitchenSimulation::Options options;
+    std::fill(std::begin(options.lines), std::end(options.lines), 24u);
+    options.lines[static_cast<std::size_t>(KitchenSimulation::Station::COLD)] = 40;    // appetizers and raw mains
+    options.lines[static_cast<std::size_t>(KitchenSimulation::Station::PASTRY)] = 48;
+    options.cooks_per_line = 16;
+    options.handoff_time = 30;
+
+    KitchenSimulation::Report reference;
+    for (unsigned threads : {1u, 2u, 4u}) {
+        options.thread_count = threads;
+        simulation.setOptions(options);
+        KitchenSimulation::Report result;
+        Clock::time_point start = Clock::now();
+        if (!simulation.run(result, error)) {
+            mismatch() << error << std::endl;
+            return;
+        }
+        report("simulate kitchen, " + std::to_string(threads) + " thread(s), per order", elapsedNs(start), count);
+        if (threads == 1) {
+            reference = result;
+            std::cout << "  " << result.events << " events in " << result.windows << " windows, "
+                      << result.items << " items, last served at " << result.end_time / 3600 << " h" << std::endl;
+            for (std::size_t s = 0; s < KitchenSimulation::kStationCount; ++s) {
+                const KitchenSimulation::StationStats& stats = result.stations[s];
+                std::cout << "  " << std::left << std::setw(8) << KitchenSimulation::stationName(static_cast<KitchenSimulation::Station>(s))
+                          << std::right << std::setw(9) << stats.cooked << " cooked, utilization " << std::setprecision(2)
+                          << stats.utilization * 100.0 << "%, max queue " << stats.max_queue << std::endl;
+            }
+            for (std::size_t m : {0, 1, 2}) {
+                const KitchenSimulation::DishStats& stats = result.dishes[m];
+                std::cout << "  " << std::left << std::setw(20) << Menu::dish(menu[m]).getName() << std::right
+                          << " p50 " << stats.p50_latency / 60 << " min, p90 " << stats.p90_latency / 60
+                          << " min, p99 " << stats.p99_latency / 60 << " min" << std::endl;
+            }
+        } else {
+            bool same = result.events == reference.events && result.end_time == reference.end_time;
+            for (std::size_t m = 0; m < menu.size(); ++m) {
+                same = same && result.dishes[m].p99_latency == reference.dishes[m].p99_latency &&
+                       result.dishes[m].mean_latency == reference.dishes[m].mean_latency;
+            }
+            for (std::size_t s = 0; s < KitchenSimulation::kStationCount; ++s) {
+                same = same && result.stations[s].total_wait == reference.stations[s].total_wait;
+            }
+            if (!same) {
+                mismatch() << threads << " threads changed the report" << std::endl;
+            }
+        }
+    }
+}
+
+// The baseline scheduler: every task goes through one deque guarded by one mutex
+class MutexQueuePool {
+public:
+    explicit MutexQueuePool(unsigned worker_count) : pending_(0), stopping_(false) {
+        for (unsigned i = 0; i < worker_count; ++i) {
+            workers_.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~MutexQueuePool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        work_ready_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+            ++pending_;
+        }
+        work_ready_.notify_one();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        all_done_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+private:
+    void workerLoop() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_ready_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0) {
+                all_done_.notify_all();
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable work_ready_;
+    std::condition_variable all_done_;
+    std::deque<std::function<void()>> tasks_;
+    std::size_t pending_;
+    bool stopping_;
+    std::vector<std::thread> workers_;
+};
+
+struct TicketResult {
+    double total = 0.0;
+    unsigned nut_items = 0;
+    unsigned vegetarian_items = 0;
+    std::size_t ticket_bytes = 0;
+};
+
+// Prices an order, checks it for allergens and renders its ticket
+TicketResult processOrder(const Menu& menu, const std::uint32_t* items, std::size_t item_count) {
+    TicketResult result;
+    std::string ticket;
+    StringSink sink(ticket);
+    {
+        MenuRenderer renderer(sink, 1024);
+        for (std::size_t i = 0; i < item_count; ++i) {
+            const Menu::Item& item = menu[items[i]];
+            result.total += Menu::dish(item).getPrice();
+            if (const Dessert* dessert = std::get_if<Dessert>(&item)) {
+                result.nut_items += dessert->containsNuts();
+            } else if (const Appetizer* appetizer = std::get_if<Appetizer>(&item)) {
+                result.vegetarian_items += appetizer->isVegetarian();
+            }
+            renderer.renderItem(item);
+        }
+    }
+    result.ticket_bytes = ticket.size();
+    return result;
+}
+
+// Replays orders through the work-stealing pool and through one mutex-guarded queue
+void benchThreadPool(std::size_t count) {
+    Menu menu;
+    for (std::size_t i = 0; i < 60; ++i) {
+        switch (i % 3) {
+            case 0: menu.add(makeAppetizer(i)); break;
+            case 1: menu.add(makeMainCourse(i)); break;
+            default: menu.add(makeDessert(i)); break;
+        }
+    }
+    std::size_t order_count = std::max<std::size_t>(count / 10, 1);
+    std::vector<std::uint32_t> offsets(1, 0);
+    std::vector<std::uint32_t> items;
+    std::mt19937 random(11);
+    for (std::size_t o = 0; o < order_count; ++o) {
+        std::size_t item_count = 2 + random() % 6;
+        for (std::size_t k = 0; k < item_count; ++k) {
+            items.push_back(random() % menu.size());
+        }
+        offsets.push_back(static_cast<std::uint32_t>(items.size()));
+    }
+    std::vector<TicketResult> results(order_count);
+    auto processRange = [&](std::size_t first, std::size_t last) {
+        for (std::size_t o = first; o < last; ++o) {
+            results[o] = processOrder(menu, items.data() + offsets[o], offsets[o + 1] - offsets[o]);
+        }
+    };
+    auto checksum = [&]() {
+        double total = 0.0;
+        std::size_t bytes = 0;
+        for (const TicketResult& result : results) {
+            total += result.total;
+            bytes += result.ticket_bytes + result.nut_items + result.vegetarian_items;
+        }
+        return total + static_cast<double>(bytes);
+    };
+
+    Clock::time_point start = Clock::now();
+    processRange(0, order_count);
+    report("replay orders, serial", elapsedNs(start), order_count);
+    double expected = checksum();
+
+    unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> thread_counts = {1, 2, 4};
+    if (hardware > 4) {
+        thread_counts.push_back(hardware);
+    }
+    const std::size_t grain = 64;
+    for (unsigned threads : thread_counts) {
+        std::string suffix = ", " + std::to_string(threads) + " thread(s)";
+        {
+            ThreadPool pool(threads);
+            std::fill(results.begin(), results.end(), TicketResult());
+            start = Clock::now();
+            pool.parallelFor(0, order_count, grain, processRange);
+            report("replay orders, work stealing" + suffix, elapsedNs(start), order_count);
+            if (checksum() != expected) {
+                mismatch() << "work stealing replay" << std::endl;
+            }
+        }
+        // Per-task overhead: one empty task per index
+        {
+            ThreadPool pool(threads);
+            std::atomic<std::size_t> ran(0);
+            start = Clock::now();
+            pool.parallelFor(0, order_count, 1, [&ran](std::size_t first, std::size_t last) {
+                ran.fetch_add(last - first, std::memory_order_relaxed);
+            });
+            report("empty tasks, work stealing" + suffix, elapsedNs(start), order_count);
+            MutexQueuePool mutex_pool(threads);
+            start = Clock::now();
+            for (std::size_t i = 0; i < order_count; ++i) {
+                mutex_pool.submit([&ran] { ran.fetch_add(1, std::memory_order_relaxed); });
+            }
+            mutex_pool.wait();
+            report("empty tasks, mutex queue" + suffix, elapsedNs(start), order_count);
+            if (ran.load() != 2 * order_count) {
+                mismatch() << "empty tasks lost" << std::endl;
+            }
+        }
+        for (std::size_t task_size : {grain, std::size_t(1)}) {
+            MutexQueuePool pool(threads);
+            std::fill(results.begin(), results.end(), TicketResult());
+            start = Clock::now();
+            for (std::size_t first = 0; first < order_count; first += task_size) {
+                std::size_t last = std::min(order_count, first + task_size);
+                pool.submit([&processRange, first, last] { processRange(first, last); });
+            }
+            pool.wait();
+            report("replay orders, mutex queue of " + std::to_string(task_size) + suffix, elapsedNs(start), order_count);
+            if (checksum() != expected) {
+                mismatch() << "mutex queue replay" << std::endl;
+            }
+        }
+    }
+}
+
+// Handoff baseline: a std::queue behind a std::mutex, bounded like the lock-free queue
+class MutexTicketQueue {
+public:
+    explicit MutexTicketQueue(std::size_t capacity) : capacity_(capacity) {
+    }
+
+    std::size_t tryPushBatch(const OrderTicket* tickets, std::size_t count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t pushed = std::min(count, capacity_ - queue_.size());
+        for (std::size_t i = 0; i < pushed; ++i) {
+            queue_.push(tickets[i]);
+        }
+        return pushed;
+    }
+
+    std::size_t tryPopBatch(OrderTicket* tickets, std::size_t max_count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t popped = std::min(max_count, queue_.size());
+        for (std::size_t i = 0; i < popped; ++i) {
+            tickets[i] = queue_.front();
+            queue_.pop();
+        }
+        return popped;
+    }
+
+    bool tryPush(const OrderTicket& ticket) {
+        return tryPushBatch(&ticket, 1) == 1;
+    }
+
+    bool tryPop(OrderTicket& ticket) {
+        return tryPopBatch(&ticket, 1) == 1;
+    }
+
+private:
+    std::mutex mutex_;
+    std::queue<OrderTicket> queue_;
+    std::size_t capacity_;
+};
+
+struct HandoffResult {
+    double elapsed_ns = 0.0;
+    std::uint64_t dish_id_sum = 0;
+    std::vector<std::uint64_t> latencies;       // enqueue to dequeue, one per ticket
+};
+
+// Nanoseconds on the clock both sides of a handoff stamp tickets with
+std::uint64_t nowNs() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+}
+
+// Moves `tickets` tickets from `producers` threads to `consumers` threads, `batch` at a time, yielding when
+// the queue is full or empty
+template <typename Queue>
+HandoffResult runHandoff(Queue& queue, unsigned producers, unsigned consumers, std::size_t tickets, std::size_t batch) {
+    std::atomic<bool> go(false);
+    std::atomic<std::size_t> consumed(0);
+    std::vector<std::vector<std::uint64_t>> latencies(consumers);
+    std::vector<std::uint64_t> sums(consumers, 0);
+    std::vector<std::thread> threads;
+
+    for (unsigned p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            std::vector<OrderTicket> buffer(batch);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            std::size_t next = p;
+            while (next < tickets) {
+                std::size_t filled = 0;
+                std::uint64_t now = nowNs();
+                for (; filled < batch && next < tickets; ++filled, next += producers) {
+                    buffer[filled] = OrderTicket{static_cast<std::uint32_t>(next), static_cast<std::uint16_t>(next % 64),
+                                                 static_cast<std::uint16_t>(next % 7 == 0 ? OrderTicket::NO_NUTS : 0), now};
+                }
+                std::size_t sent = 0;
+                while (sent < filled) {
+                    std::size_t pushed = batch == 1 ? std::size_t(queue.tryPush(buffer[sent])) : queue.tryPushBatch(buffer.data() + sent, filled - sent);
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                    sent += pushed;
+                }
+            }
+        });
+    }
+    for (unsigned c = 0; c < consumers; ++c) {
+        latencies[c].reserve(tickets / consumers + batch);
+        threads.emplace_back([&, c] {
+            std::vector<OrderTicket> buffer(batch);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            while (consumed.load(std::memory_order_relaxed) < tickets) {
+                std::size_t popped = batch == 1 ? std::size_t(queue.tryPop(buffer[0])) : queue.tryPopBatch(buffer.data(), batch);
+                if (popped == 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                std::uint64_t now = nowNs();
+                for (std::size_t i = 0; i < popped; ++i) {
+                    latencies[c].push_back(now - buffer[i].timestamp);
+                    sums[c] += buffer[i].dish_id;
+                }
+                consumed.fetch_add(popped, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    HandoffResult result;
+    Clock::time_point start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    result.elapsed_ns = elapsedNs(start);
+    for (unsigned c = 0; c < consumers; ++c) {
+        result.dish_id_sum += sums[c];
+        result.latencies.insert(result.latencies.end(), latencies[c].begin(), latencies[c].end());
+    }
+    return result;
+}
+
+void benchTicketQueue(std::size_t count) {
+    const std::size_t capacity = 1024;
+    std::size_t tickets = std::max<std::size_t>(count, 1);
+    std::uint64_t expected = static_cast<std::uint64_t>(tickets) * (tickets - 1) / 2;
+
+    auto reportHandoff = [&](const std::string& name, HandoffResult& result) {
+        report(name, result.elapsed_ns, tickets);
+        std::vector<std::uint64_t>& latencies = result.latencies;
+        if (latencies.size() != tickets || result.dish_id_sum != expected) {
+            mismatch() << name << " delivered " << latencies.size() << " tickets" << std::endl;
+            return;
+        }
+        auto percentile = [&latencies](double fraction) {
+            std::size_t rank = std::min(latencies.size() - 1, static_cast<std::size_t>(fraction * latencies.size()));
+            std::nth_element(latencies.begin(), latencies.begin() + rank, latencies.end());
+            return latencies[rank] / 1000.0;
+        };
+        double p50 = percentile(0.50);
+        double p99 = percentile(0.99);
+        double p999 = percentile(0.999);
+        std::cout << "  handoff latency us: p50 " << std::fixed << std::setprecision(1) << p50 << ", p99 " << p99
+                  << ", p99.9 " << p999 << ", max " << *std::max_element(latencies.begin(), latencies.end()) / 1000.0 << std::endl;
+    };
+
+    // Producer and consumer thread pairs, 2 to 64 threads in total
+    for (unsigned pairs : {1u, 2u, 4u, 8u, 16u, 32u}) {
+        std::string suffix = ", " + std::to_string(pairs) + "P/" + std::to_string(pairs) + "C";
+        {
+            MutexTicketQueue queue(capacity);
+            HandoffResult result = runHandoff(queue, pairs, pairs, tickets, 1);
+            reportHandoff("handoff mutex + std::queue" + suffix, result);
+        }
+        {
+            TicketQueue queue(capacity);
+            HandoffResult result = runHandoff(queue, pairs, pairs, tickets, 1);
+            reportHandoff("handoff lock-free" + suffix, result);
+        }
+        {
+            TicketQueue queue(capacity);
+            HandoffResult result = runHandoff(queue, pairs, pairs, tickets, 16);
+            reportHandoff("handoff lock-free, batches of 16" + suffix, result);
+        }
+    }
+}
+
+// Readers price and render orders from a menu while a manager rebalances prices every millisecond. Every
+// update moves money between the first two items, so a consistent view always sees the same sum.
+void benchConcurrentMenu(std::size_t count) {
+    Menu menu;
+    for (std::size_t i = 0; i < 300; ++i) {
+        switch (i % 3) {
+            case 0: menu.add(makeAppetizer(i)); break;
+            case 1: menu.add(makeMainCourse(i)); break;
+            default: menu.add(makeDessert(i)); break;
+        }
+    }
+    const double pair_total = Menu::dish(menu[0]).getPrice() + Menu::dish(menu[1]).getPrice();
+    const std::size_t batch = 32;
+    std::size_t reads = std::max<std::size_t>(count / 10, 1);
+
+    auto setPrice = [](Menu::Item& item, double price) {
+        std::visit([price](Dish& dish) { dish.setPrice(price); }, item);
+    };
+    // The changes of one update: the first pair and a batch of other prices
+    auto applyBatch = [&](Menu& target, std::size_t round) {
+        double shift = static_cast<double>(round % 100) / 10.0;
+        setPrice(target[0], pair_total / 2 + shift);
+        setPrice(target[1], pair_total / 2 - shift);
+        for (std::size_t k = 0; k < batch; ++k) {
+            std::size_t index = 2 + (round * batch + k) % (target.size() - 2);
+            setPrice(target[index], 5.0 + static_cast<double>((round + k) % 40));
+        }
+    };
+    auto orderOf = [&](std::size_t r, std::uint32_t* items) {
+        for (std::size_t k = 0; k < 4; ++k) {
+            items[k] = static_cast<std::uint32_t>((r * 7 + k * 13) % menu.size());
+        }
+    };
+
+    // Runs readers (and a writer calling publish every millisecond) and returns the reads per second
+    auto run = [&](const std::string& name, unsigned readers, bool writing, const std::function<bool(std::size_t)>& read,
+                   const std::function<void(std::size_t)>& publish) {
+        std::atomic<bool> done(false);
+        std::atomic<std::size_t> inconsistent(0);
+        std::size_t publishes = 0;
+        std::thread writer;
+        if (writing) {
+            writer = std::thread([&] {
+                while (!done.load(std::memory_order_acquire)) {
+                    publish(publishes++);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            });
+        }
+        Clock::time_point start = Clock::now();
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < readers; ++t) {
+            threads.emplace_back([&, t] {
+                for (std::size_t r = t; r < reads; r += readers) {
+                    if (!read(r)) {
+                        inconsistent.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        double elapsed = elapsedNs(start);
+        done.store(true, std::memory_order_release);
+        if (writer.joinable()) {
+            writer.join();
+        }
+        report(name, elapsed, reads);
+        if (writing) {
+            std::cout << "  " << publishes << " updates of " << batch + 2 << " prices" << std::endl;
+        }
+        if (inconsistent.load() != 0) {
+            mismatch() << name << " saw " << inconsistent.load() << " torn updates" << std::endl;
+        }
+    };
+
+    unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> thread_counts = {1, 4, 16};
+    if (hardware > 16) {
+        thread_counts.push_back(hardware);
+    }
+    for (unsigned readers : thread_counts) {
+        std::string suffix = ", " + std::to_string(readers) + " reader(s)";
+        {
+            ConcurrentMenu shared(menu);
+            auto read = [&](std::size_t r) {
+                std::uint32_t items[4];
+                orderOf(r, items);
+                ConcurrentMenu::Snapshot snapshot = shared.snapshot();
+                const Menu& view = snapshot.menu();
+                processOrder(view, items, 4);
+                return Menu::dish(view[0]).getPrice() + Menu::dish(view[1]).getPrice() == pair_total;
+            };
+            auto publish = [&](std::size_t round) {
+                ConcurrentMenu::Update update = shared.update();
+                applyBatch(update.menu(), round);
+                update.commit();
+            };
+            run("snapshot reads, no updates" + suffix, readers, false, read, publish);
+            run("snapshot reads, RCU updates" + suffix, readers, true, read, publish);
+        }
+        {
+            Menu guarded(menu);
+            std::shared_mutex mutex;
+            auto read = [&](std::size_t r) {
+                std::uint32_t items[4];
+                orderOf(r, items);
+                std::shared_lock<std::shared_mutex> lock(mutex);
+                processOrder(guarded, items, 4);
+                return Menu::dish(guarded[0]).getPrice() + Menu::dish(guarded[1]).getPrice() == pair_total;
+            };
+            auto publish = [&](std::size_t round) {
+                std::unique_lock<std::shared_mutex> lock(mutex);
+                applyBatch(guarded, round);
+            };
+            run("shared_mutex reads, in-place updates" + suffix, readers, true, read, publish);
+        }
+    }
+
+    EpochDomain::global().reclaim();
+    if (EpochDomain::global().retiredCount() != 0) {
+        mismatch() << EpochDomain::global().retiredCount() << " menu versions never reclaimed" << std::endl;
+    }
+}
+
+// The dashboard of MenuStatistics, in the order of rescanDashboard()
+std::vector<MenuStatistics::Stats> dashboardOf(const MenuStatistics& statistics) {
+    std::vector<MenuStatistics::Stats> dashboard;
+    dashboard.push_back(statistics.total());
+    for (int c = 0; c < 7; ++c) {
+        dashboard.push_back(statistics.byCuisineType(static_cast<Dish::CuisineType>(c)));
+    }
+    for (int c = 0; c < 4; ++c) {
+        dashboard.push_back(statistics.byCourse(static_cast<Dish::Course>(c)));
+    }
+    for (int s = 0; s < 3; ++s) {
+        dashboard.push_back(statistics.byServingStyle(static_cast<Appetizer::ServingStyle>(s)));
+    }
+    for (int m = 0; m < 5; ++m) {
+        dashboard.push_back(statistics.byCookingMethod(static_cast<MainCourse::CookingMethod>(m)));
+    }
+    for (int f = 0; f < 5; ++f) {
+        dashboard.push_back(statistics.byFlavorProfile(static_cast<Dessert::FlavorProfile>(f)));
+    }
+    for (bool value : {false, true}) {
+        dashboard.push_back(statistics.byVegetarian(value));
+    }
+    for (bool value : {false, true}) {
+        dashboard.push_back(statistics.byGlutenFree(value));
+    }
+    for (bool value : {false, true}) {
+        dashboard.push_back(statistics.byContainsNuts(value));
+    }
+    return dashboard;
+}
+
+// Recomputes the same dashboard by scanning every dish
+std::vector<MenuStatistics::Stats> rescanDashboard(const Menu& menu) {
+    std::vector<MenuStatistics::Stats> dashboard(1 + 7 + 4 + 3 + 5 + 5 + 6, MenuStatistics::Stats{0, 0.0, 0, 0, 0});
+    auto count = [&dashboard](std::size_t group, const Dish& dish) {
+        MenuStatistics::Stats& stats = dashboard[group];
+        int prep_time = dish.getPrepTime();
+        if (stats.count == 0 || prep_time < stats.min_prep_time) {
+            stats.min_prep_time = prep_time;
+        }
+        if (stats.count == 0 || prep_time > stats.max_prep_time) {
+            stats.max_prep_time = prep_time;
+        }
+        ++stats.count;
+        stats.total_price += dish.getPrice();
+        stats.total_prep_time += prep_time;
+    };
+    for (std::size_t i = 0; i < menu.size(); ++i) {
+        const Menu::Item& item = menu[i];
+        const Dish& dish = Menu::dish(item);
+        count(0, dish);
+        count(1 + static_cast<std::size_t>(dish.getCuisineTypeEnum()), dish);
+        count(8 + item.index(), dish);
+        if (const Appetizer* appetizer = std::get_if<Appetizer>(&item)) {
+            count(12 + appetizer->getServingStyle(), dish);
+            count(25 + appetizer->isVegetarian(), dish);
+        } else if (const MainCourse* main_course = std::get_if<MainCourse>(&item)) {
+            count(15 + main_course->getCookingMethod(), dish);
+            count(27 + main_course->isGlutenFree(), dish);
+        } else if (const Dessert* dessert = std::get_if<Dessert>(&item)) {
+            count(20 + dessert->getFlavorProfile(), dish);
+            count(29 + dessert->containsNuts(), dish);
+        }
+    }
+    return dashboard;
+}
+
+bool sameDashboard(const std::vector<MenuStatistics::Stats>& a, const std::vector<MenuStatistics::Stats>& b) {
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (a[i].count != b[i].count || a[i].total_prep_time != b[i].total_prep_time || a[i].min_prep_time != b[i].min_prep_time ||
+            a[i].max_prep_time != b[i].max_prep_time || std::abs(a[i].total_price - b[i].total_price) > 1e-6 * (a[i].count + 1)) {
+            return false;
+        }
+    }
+    return a.size() == b.size();
+}
+
+// A manager changes dishes one at a time and the dashboard is refreshed after every change
+void benchMenuStatistics(std::size_t count) {
+    Menu menu;
+    menu.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        switch (i % 3) {
+            case 0: menu.add(makeAppetizer(i)); break;
+            case 1: menu.add(makeMainCourse(i)); break;
+            default: menu.add(makeDessert(i)); break;
+        }
+    }
+    std::size_t changes = 200;
+    std::mt19937 random(5);
+    // Every change raises the fastest dish of a group past the slowest, so minimums and maximums move
+    auto change = [&](std::size_t c) {
+        std::size_t index = random() % menu.size();
+        Menu::Item& item = menu[index];
+        std::visit([c](Dish& dish) {
+            dish.setPrice(dish.getPrice() + 0.25);
+            dish.setPrepTime(dish.getPrepTime() < 10 ? 70 + static_cast<int>(c % 5) : dish.getPrepTime() - 1);
+        }, item);
+        if (MainCourse* main_course = std::get_if<MainCourse>(&item)) {
+            main_course->setGlutenFree(!main_course->isGlutenFree());
+            main_course->setCuisineType(static_cast<Dish::CuisineType>(c % 7));
+        } else if (Dessert* dessert = std::get_if<Dessert>(&item)) {
+            dessert->setFlavorProfile(static_cast<Dessert::FlavorProfile>(c % 5));
+        }
+    };
+
+    Clock::time_point start = Clock::now();
+    std::vector<MenuStatistics::Stats> scanned;
+    for (std::size_t c = 0; c < changes; ++c) {
+        change(c);
+        scanned = rescanDashboard(menu);
+    }
+    report("change + rescan dashboard", elapsedNs(start), changes);
+
+    start = Clock::now();
+    MenuStatistics statistics;
+    for (std::size_t i = 0; i < menu.size(); ++i) {
+        std::visit([&statistics](Dish& dish) { statistics.add(dish); }, menu[i]);
+    }
+    report("build MenuStatistics", elapsedNs(start), menu.size());
+
+    random.seed(5);
+    std::vector<MenuStatistics::Stats> incremental;
+    start = Clock::now();
+    for (std::size_t c = 0; c < changes; ++c) {
+        change(c);
+        incremental = dashboardOf(statistics);
+    }
+    report("change + incremental dashboard", elapsedNs(start), changes);
+    if (!sameDashboard(incremental, rescanDashboard(menu))) {
+        mismatch() << "incremental dashboard after changes" << std::endl;
+    }
+
+    // Removing dishes must restore the minimums and maximums of the rest
+    std::size_t removed = 0;
+    for (std::size_t i = 0; i < menu.size(); i += 2) {
+        statistics.remove(Menu::dish(menu[i]));
+        ++removed;
+    }
+    Menu rest;
+    for (std::size_t i = 1; i < menu.size(); i += 2) {
+        std::visit([&rest](const auto& dish) { rest.add(dish); }, menu[i]);
+    }
+    if (!sameDashboard(dashboardOf(statistics), rescanDashboard(rest))) {
+        mismatch() << "incremental dashboard after " << removed << " removals" << std::endl;
+    }
+
+    // The cost of keeping the statistics up to date, per setter call
+    start = Clock::now();
+    for (std::size_t i = 1; i < menu.size(); i += 2) {
+        std::visit([](Dish& dish) { dish.setPrice(dish.getPrice() + 1.0); }, menu[i]);
+    }
+    report("setPrice with MenuStatistics observing", elapsedNs(start), menu.size() / 2);
+    start = Clock::now();
+    for (std::size_t i = 0; i < menu.size(); i += 2) {
+        std::visit([](Dish& dish) { dish.setPrice(dish.getPrice() + 1.0); }, menu[i]);
+    }
+    report("setPrice without observer", elapsedNs(start), (menu.size() + 1) / 2);
+}
+
+// Builds the catalog most other benchmarks start from
+void benchCatalogBuild(std::size_t count) {
+    Clock::time_point start = Clock::now();
+    DishCatalog catalog = makeCatalog(count);
+    report("build DishCatalog (mixed courses)", elapsedNs(start), catalog.size());
+}
+
+// Sends std::cout to another stream while it is alive, for timing the display functions
+class CoutRedirect {
+public:
+    explicit CoutRedirect(std::ostream& target) : saved_(std::cout.rdbuf(target.rdbuf())) {
+    }
+
+    ~CoutRedirect() {
+        std::cout.rdbuf(saved_);
+    }
+
+private:
+    std::streambuf* saved_;
+};
+
+// Construction, copies, getters, name validation and display of every class of the hierarchy, at several
+// menu sizes, with warm-up and repetitions (see measure())
+void benchDishHierarchy(std::size_t count) {
+    std::vector<std::size_t> sizes;
+    for (std::size_t size : {std::size_t(1000), std::size_t(10000), count}) {
+        if (size <= count && (sizes.empty() || size > sizes.back())) {
+            sizes.push_back(size);
+        }
+    }
+    std::vector<std::vector<std::string>> ingredient_lists;
+    for (std::size_t i = 0; i < 16; ++i) {
+        ingredient_lists.push_back(makeIngredients(i));
+    }
+    std::vector<MainCourse::SideDish> side_dishes = {{"Green Beans", MainCourse::VEGETABLE}, {"Rice", MainCourse::GRAIN}};
+    std::ofstream null_stream("/dev/null");
+
+    for (std::size_t n : sizes) {
+        std::string suffix = ", n=" + std::to_string(n);
+        std::vector<Dish> dishes;
+        std::vector<Appetizer> appetizers;
+        std::vector<MainCourse> main_courses;
+        std::vector<Dessert> desserts;
+        dishes.reserve(n);
+        appetizers.reserve(n);
+        main_courses.reserve(n);
+        desserts.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            dishes.push_back(makeDish(i));
+            appetizers.push_back(makeAppetizer(i));
+            main_courses.push_back(makeMainCourse(i));
+            desserts.push_back(makeDessert(i));
+        }
+
+        // Construction and copies; each run destroys the previous run's objects first
+        auto constructDefault = [&](auto& out, const std::string& name) {
+            out.reserve(n);
+            measure("default construct " + name + suffix, n, [&] {
+                out.clear();
+                for (std::size_t i = 0; i < n; ++i) {
+                    out.emplace_back();
+                }
+                return out.size();
+            });
+        };
+        auto copy = [&](auto& out, const auto& source, const std::string& name) {
+            out.reserve(n);
+            measure("copy " + name + suffix, n, [&] {
+                out.clear();
+                for (std::size_t i = 0; i < n; ++i) {
+                    out.push_back(source[i]);
+                }
+                return out.size();
+            });
+        };
+        {
+            std::vector<Dish> out;
+            constructDefault(out, "Dish");
+            measure("construct Dish" + suffix, n, [&] {
+                out.clear();
+                for (std::size_t i = 0; i < n; ++i) {
+                    out.emplace_back(kNames[i % kNames.size()], ingredient_lists[i % 16], 20, 9.99, Dish::CuisineType::ITALIAN);
+                }
+                return out.size();
+            });
+            copy(out, dishes, "Dish");
+        }
+        {
+            std::vector<Appetizer> out;
+            constructDefault(out, "Appetizer");
+            measure("construct Appetizer" + suffix, n, [&] {
+                out.clear();
+                for (std::size_t i = 0; i < n; ++i) {
+                    out.emplace_back(kNames[i % kNames.size()], ingredient_lists[i % 16], 10, 6.99, Dish::CuisineType::MEXICAN,
+                                     Appetizer::PLATED, 3, true);
+                }
+                return out.size();
+            });
+            copy(out, appetizers, "Appetizer");
+        }
+        {
+            std::vector<MainCourse> out;
+            constructDefault(out, "MainCourse");
+            measure("construct MainCourse" + suffix, n, [&] {
+                out.clear();
+                for (std::size_t i = 0; i < n; ++i) {
+                    out.emplace_back(kNames[i % kNames.size()], ingredient_lists[i % 16], 35, 18.99, Dish::CuisineType::FRENCH,
+                                     MainCourse::BAKED, "Chicken", side_dishes, false);
+                }
+                return out.size();
+            });
+            copy(out, main_courses, "MainCourse");
+        }
+        {
+            std::vector<Dessert> out;
+            constructDefault(out, "Dessert");
+            measure("construct Dessert" + suffix, n, [&] {
+                out.clear();
+                for (std::size_t i = 0; i < n; ++i) {
+                    out.emplace_back(kNames[i % kNames.size()], ingredient_lists[i % 16], 25, 7.99, Dish::CuisineType::AMERICAN,
+                                     Dessert::SWEET, 8, true);
+                }
+                return out.size();
+            });
+            copy(out, desserts, "Dessert");
+        }
+
+        // Getters, over the Dish part of the main courses and then the class-specific ones
+        measure("getPrepTime/getPrice/getCourse" + suffix, n, [&] {
+            std::size_t sum = 0;
+            for (const MainCourse& dish : main_courses) {
+                sum += static_cast<std::size_t>(dish.getPrepTime()) + static_cast<std::size_t>(dish.getPrice()) + static_cast<std::size_t>(dish.getCourse());
+            }
+            return sum;
+        });
+        measure("getName" + suffix, n, [&] {
+            std::size_t sum = 0;
+            for (const MainCourse& dish : main_courses) {
+                sum += dish.getName().size();
+            }
+            return sum;
+        });
+        measure("getCuisineType" + suffix, n, [&] {
+            std::size_t sum = 0;
+            for (const MainCourse& dish : main_courses) {
+                sum += dish.getCuisineType().size();
+            }
+            return sum;
+        });
+        measure("getIngredients (by value)" + suffix, n, [&] {
+            std::size_t sum = 0;
+            for (const MainCourse& dish : main_courses) {
+                sum += dish.getIngredients().size();
+            }
+            return sum;
+        });
+        measure("getSideDishes (by value)" + suffix, n, [&] {
+            std::size_t sum = 0;
+            for (const MainCourse& dish : main_courses) {
+                sum += dish.getSideDishes().size();
+            }
+            return sum;
+        });
+        measure("getProteinType" + suffix, n, [&] {
+            std::size_t sum = 0;
+            for (const MainCourse& dish : main_courses) {
+                sum += dish.getProteinType().size();
+            }
+            return sum;
+        });
+        measure("Appetizer getters" + suffix, n, [&] {
+            std::size_t sum = 0;
+            for (const Appetizer& appetizer : appetizers) {
+                sum += appetizer.getServingStyle() + static_cast<std::size_t>(appetizer.getSpicinessLevel()) + appetizer.isVegetarian();
+            }
+            return sum;
+        });
+        measure("MainCourse getters" + suffix, n, [&] {
+            std::size_t sum = 0;
+            for (const MainCourse& main_course : main_courses) {
+                sum += main_course.getCookingMethod() + main_course.isGlutenFree();
+            }
+            return sum;
+        });
+        measure("Dessert getters" + suffix, n, [&] {
+            std::size_t sum = 0;
+            for (const Dessert& dessert : desserts) {
+                sum += dessert.getFlavorProfile() + static_cast<std::size_t>(dessert.getSweetnessLevel()) + dessert.containsNuts();
+            }
+            return sum;
+        });
+
+        // Name validation, one name in eight invalid
+        std::vector<std::string> names;
+        for (std::size_t i = 0; i < n; ++i) {
+            names.push_back(i % 8 == 7 ? kNames[i % kNames.size()] + " #" + std::to_string(i) : kNames[i % kNames.size()]);
+        }
+        measure("isValidName" + suffix, n, [&] {
+            std::size_t valid = 0;
+            for (const std::string& name : names) {
+                valid += Dish::isValidName(name);
+            }
+            return valid;
+        });
+
+        // Display functions, with std::cout sent to /dev/null while they run
+        measure("Dish::display" + suffix, n, [&] {
+            CoutRedirect redirect(null_stream);
+            for (const Dish& dish : dishes) {
+                dish.display();
+            }
+            return dishes.size();
+        });
+        measure("displayAppetizer" + suffix, n, [&] {
+            CoutRedirect redirect(null_stream);
+            for (const Appetizer& appetizer : appetizers) {
+                appetizer.displayAppetizer();
+            }
+            return appetizers.size();
+        });
+        measure("displayMainCourse" + suffix, n, [&] {
+            CoutRedirect redirect(null_stream);
+            for (const MainCourse& main_course : main_courses) {
+                main_course.displayMainCourse();
+            }
+            return main_courses.size();
+        });
+        measure("displayDessert" + suffix, n, [&] {
+            CoutRedirect redirect(null_stream);
+            for (const Dessert& dessert : desserts) {
+                dessert.displayDessert();
+            }
+            return desserts.size();
+        });
+    }
+}
+
+// Counts the copies and allocations of adding main courses to a Menu and reading them through the by-value
+// getters; only counts when built with make INSTRUMENT=1
+void benchInstrumentation(std::size_t count) {
+    if (!DishInstrumentation::enabled()) {
+        DishInstrumentation::report(std::cout);
+        return;
+    }
+    std::size_t n = std::min<std::size_t>(count, 10000);
+    std::vector<MainCourse> main_courses;
+    main_courses.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        main_courses.push_back(makeMainCourse(i));
+    }
+
+    DishInstrumentation::reset();
+    Menu menu;
+    menu.reserve(n);
+    std::size_t checksum = 0;
+    for (const MainCourse& main_course : main_courses) {
+        menu.add(main_course);
+    }
+    for (std::size_t i = 0; i < menu.size(); ++i) {
+        const MainCourse& main_course = std::get<MainCourse>(menu[i]);
+        checksum += main_course.getName().size() + main_course.getIngredients().size() + main_course.getCuisineType().size();
+        checksum += main_course.getProteinType().size() + main_course.getSideDishes().size();
+    }
+    std::cout << "  " << n << " main courses added to a Menu and read through every by-value getter (checksum " << checksum << "):" << std::endl;
+    DishInstrumentation::report(std::cout);
+    DishInstrumentation::Totals totals = DishInstrumentation::collect();
+    if (totals.get(DishInstrumentation::Subject::MAIN_COURSE, DishInstrumentation::Counter::COPIES) != n ||
+        totals.get(DishInstrumentation::Subject::GET_NAME, DishInstrumentation::Counter::CALLS) != n) {
+        mismatch() << "instrumentation counts" << std::endl;
+    }
+}
+
+// Memory resource that counts the blocks and bytes handed out by another one
+class CountingResource : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream) : upstream_(upstream), allocations_(0), bytes_(0) {
+    }
+
+    std::size_t allocations() const {
+        return allocations_;
+    }
+
+    std::size_t bytes() const {
+        return bytes_;
+    }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations_;
+        bytes_ += bytes;
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* block, std::size_t bytes, std::size_t alignment) override {
+        upstream_->deallocate(block, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream_;
+    std::size_t allocations_;
+    std::size_t bytes_;
+};
+
+// Measures the footprint of a realistic mixed menu and the speed of walking its ingredient and side dish lists
+void benchSmallVector(std::size_t count) {
+    Menu source;
+    source.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        switch (i % 3) {
+            case 0: source.add(makeAppetizer(i)); break;
+            case 1: source.add(makeMainCourse(i)); break;
+            default: source.add(makeDessert(i)); break;
+        }
+    }
+    std::cout << "sizeof(Dish): " << sizeof(Dish) << " bytes, sizeof(MainCourse): " << sizeof(MainCourse)
+              << " bytes, sizeof(Menu::Item): " << sizeof(Menu::Item) << " bytes" << std::endl;
+
+    // Copying the menu takes blocks from the default memory resource only for lists that do not fit inline
+    // and for strings that do not fit in their own inline buffer
+    CountingResource counting(std::pmr::new_delete_resource());
+    std::pmr::memory_resource* previous = std::pmr::set_default_resource(&counting);
+    releaseFreedMemory();
+    long before = residentKb();
+    Menu menu(source);
+    long resident = residentKb() - before;
+    std::pmr::set_default_resource(previous);
+    std::cout << "copy menu: " << static_cast<double>(counting.allocations()) / count << " blocks and "
+              << static_cast<double>(counting.bytes()) / count << " block bytes per item, "
+              << static_cast<double>(resident) * 1024 / count << " resident bytes per item" << std::endl;
+
+    measure("walk ingredient ids", count, [&] {
+        std::size_t sum = 0;
+        menu.visit([&](const Dish& dish) {
+            for (SymbolTable::Id id : dish.getIngredientIdsView()) {
+                sum += id;
+            }
+        });
+        return sum;
+    });
+    measure("walk side dish categories", count, [&] {
+        std::size_t sum = 0;
+        menu.visit([&](const auto& dish) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(dish)>, MainCourse>) {
+                for (const MainCourse::PackedSideDish& side_dish : dish.getPackedSideDishesView()) {
+                    sum += side_dish.category + 1;
+                }
+            }
+        });
+        return sum;
+    });
+}
+
+// Finds the main courses served with a VEGETABLE or SALAD side through the side dish lists, the category
+// mask of each dish and the attribute column of a catalog
+void benchSideDishQuery(std::size_t count) {
+    std::vector<MainCourse> main_courses;
+    for (std::size_t i = 1; i < count; i += 3) {
+        main_courses.push_back(makeMainCourse(i));
+    }
+    DishCatalog catalog = makeCatalog(count);
+    std::size_t mains = main_courses.size();
+    std::cout << "main courses: " << mains << ", sizeof(MainCourse): " << sizeof(MainCourse)
+              << " bytes, sizeof(Menu::Item): " << sizeof(Menu::Item) << " bytes" << std::endl;
+
+    const std::uint32_t categories = MainCourse::sideDishCategoryBit(MainCourse::VEGETABLE) |
+                                     MainCourse::sideDishCategoryBit(MainCourse::SALAD);
+    std::size_t expected = 0;
+    std::size_t both = 0;
+    for (const MainCourse& main_course : main_courses) {
+        bool vegetable = false;
+        bool salad = false;
+        for (const MainCourse::SideDish& side_dish : main_course.getSideDishes()) {
+            vegetable |= side_dish.category == MainCourse::VEGETABLE;
+            salad |= side_dish.category == MainCourse::SALAD;
+        }
+        expected += vegetable || salad;
+        both += vegetable && salad;
+    }
+
+    std::size_t found = 0;
+    measure("walk side dishes per main course", mains, [&] {
+        found = 0;
+        for (const MainCourse& main_course : main_courses) {
+            for (const MainCourse::PackedSideDish& side_dish : main_course.getPackedSideDishesView()) {
+                if (categories & MainCourse::sideDishCategoryBit(side_dish.category)) {
+                    ++found;
+                    break;
+                }
+            }
+        }
+        return found;
+    });
+    if (found != expected) {
+        mismatch() << found << " vs " << expected << std::endl;
+    }
+    measure("category mask per main course", mains, [&] {
+        found = 0;
+        for (const MainCourse& main_course : main_courses) {
+            found += (main_course.getSideDishCategories() & categories) != 0;
+        }
+        return found;
+    });
+    if (found != expected) {
+        mismatch() << found << " vs " << expected << std::endl;
+    }
+    measure("catalog side dish lists", catalog.size(), [&] {
+        found = 0;
+        for (std::size_t i = 0; i < catalog.size(); ++i) {
+            DishCatalog::Row row = catalog[i];
+            for (std::size_t k = 0; k < row.getSideDishCount(); ++k) {
+                if (categories & MainCourse::sideDishCategoryBit(row.getSideDishCategory(k))) {
+                    ++found;
+                    break;
+                }
+            }
+        }
+        return found;
+    });
+    if (found != expected) {
+        mismatch() << found << " vs " << expected << std::endl;
+    }
+    measure("catalog attribute column, " + std::string(DishFilter::isaName(DishFilter::activeIsa())), catalog.size(), [&] {
+        found = DishFilter::count(DishFilter::sideDishCategoryAny(catalog, categories));
+        return found;
+    });
+    if (found != expected) {
+        mismatch() << found << " vs " << expected << std::endl;
+    }
+
+    // Both categories at once is an AttributeFilter
+    AttributeFilter filter;
+    filter.sideDishCategory(MainCourse::VEGETABLE, true).sideDishCategory(MainCourse::SALAD, true);
+    if (DishFilter::count(DishFilter::attributesMatch(catalog, filter)) != both) {
+        mismatch() << "VEGETABLE and SALAD filter" << std::endl;
+    }
+}
+
+struct Benchmark {
+    const char* name;
+    void (*run)(std::size_t count);
+};
+
+// Every benchmark, in the order they run
+const Benchmark kBenchmarks[] = {
+    {"catalog-build", benchCatalogBuild},
+    {"dish-hierarchy", benchDishHierarchy},
+    {"catalog-scan", benchCatalogScan},
+    {"filter-kernels", benchFilterKernels},
+    {"attribute-filter", benchAttributeFilter},
+    {"enum-parsing", benchEnumParsing},
+    {"name-validation", benchNameValidation},
+    {"ingredient-memory", benchIngredientMemory},
+    {"view-accessors", benchViewAccessors},
+    {"construction-allocations", benchConstructionAllocations},
+    {"arena-allocation", benchArenaAllocation},
+    {"rendering", benchRendering},
+    {"menu-container", benchMenuContainer},
+    {"menu-file", benchMenuFile},
+    {"import", benchImport},
+    {"ingredient-index", benchIngredientIndex},
+    {"ordered-index", benchOrderedIndex},
+    {"kitchen-simulation", benchKitchenSimulation},
+    {"thread-pool", benchThreadPool},
+    {"ticket-queue", benchTicketQueue},
+    {"concurrent-menu", benchConcurrentMenu},
+    {"menu-statistics", benchMenuStatistics},
+    {"instrumentation", benchInstrumentation},
+    {"small-vector", benchSmallVector},
+    {"side-dish-query", benchSideDishQuery},
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t count = 1000000;
+    std::string filter;
+    std::string json_path;
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        bool has_value = i + 1 < argc;
+        if (argument == "--filter" && has_value) {
+            filter = argv[++i];
+        } else if (argument == "--json" && has_value) {
+            json_path = argv[++i];
+        } else if (argument == "--repetitions" && has_value) {
+            settings().repetitions = std::strtoul(argv[++i], nullptr, 10);
+        } else if (argument == "--warmup" && has_value) {
+            settings().warmups = std::strtoul(argv[++i], nullptr, 10);
+        } else if (argument == "--no-counters") {
+            settings().counters = false;
+        } else if (!argument.empty() && std::isdigit(static_cast<unsigned char>(argument[0]))) {
+            count = std::strtoul(argv[i], nullptr, 10);
+        } else {
+            std::cerr << "usage: " << argv[0] << " [dishes] [--filter TEXT] [--repetitions N] [--warmup N] [--json FILE] [--no-counters]" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "Dishes: " << count << std::endl;
+    if (settings().counters) {
+        std::string error;
+        if (perfCounters().open(error) && error.empty()) {
+            std::cout << "Hardware counters: on" << std::endl;
+        } else {
+            std::cout << "Hardware counters: " << (perfCounters().isOpen() ? "partial" : "off") << " (" << error << ")" << std::endl;
+        }
+    }
+
+    for (const Benchmark& benchmark : kBenchmarks) {
+        if (filter.empty() || std::string(benchmark.name).find(filter) != std::string::npos) {
+            benchmark.run(count);
+        }
+    }
+
+    if (!json_path.empty()) {
+        std::string error;
+        if (!writeJson(json_path, count, error)) {
+            std::cerr << "Error: " << error << std::endl;
+            return 1;
+        }
+    }
+    if (failedChecks() != 0) {
+        std::cerr << "Error: " << failedChecks() << " check(s) failed" << std::endl;
+        return 1;
+    }
+    return 0;
+}